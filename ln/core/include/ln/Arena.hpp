@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace ln {
+
+/**
+ * @brief Bump-pointer (monotonic) allocator over externally provided storage.
+ *
+ * Allocation is a pointer increment, there is no per-allocation free: all
+ * memory is released at once with reset(), or back to an earlier point with
+ * rewind(). Meant for scratch memory whose lifetime ends at a well-defined
+ * point, e.g. the end of a shell command.
+ *
+ * @note Not thread-safe.
+ */
+class MonotonicArena {
+public:
+    explicit MonotonicArena(std::span<std::byte> backing_storage = {}) noexcept : storage(backing_storage) {}
+
+    MonotonicArena(const MonotonicArena &) = delete;
+    MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+    /**
+     * @brief Allocate size bytes aligned to alignment (a power of two).
+     *
+     * @return Pointer to uninitialized memory, or nullptr if it does not fit.
+     */
+    [[nodiscard]] void *allocate(size_t size, size_t alignment = alignof(std::max_align_t)) noexcept {
+        const auto base = reinterpret_cast<std::uintptr_t>(this->storage.data());
+        const std::uintptr_t aligned = (base + this->used + alignment - 1) & ~(alignment - 1);
+        const size_t offset = aligned - base;
+        if (offset > this->storage.size() || size > this->storage.size() - offset) {
+            return nullptr;
+        }
+        this->used = offset + size;
+        this->peak = std::max(this->peak, this->used);
+        return this->storage.data() + offset;
+    }
+
+    /**
+     * @brief Allocate count default-initialized elements of T.
+     *
+     * @return The elements, or an empty span if they do not fit.
+     */
+    template <typename T> [[nodiscard]] std::span<T> allocate(size_t count) noexcept {
+        static_assert(std::is_trivially_destructible_v<T>, "MonotonicArena never runs destructors");
+        if (count > this->storage.size() / sizeof(T)) {
+            return {};
+        }
+        T *elements = static_cast<T *>(this->allocate(count * sizeof(T), alignof(T)));
+        if (!elements) {
+            return {};
+        }
+        std::uninitialized_default_construct_n(elements, count);
+        return {elements, count};
+    }
+
+    /**
+     * @brief Release everything allocated so far.
+     */
+    void reset() noexcept { this->used = 0; }
+
+    /**
+     * @brief Release everything allocated after get_used_space() returned
+     * used_space.
+     */
+    void rewind(size_t used_space) noexcept { this->used = std::min(this->used, used_space); }
+
+    /**
+     * @brief Returns the capacity in bytes.
+     */
+    [[nodiscard]] size_t capacity() const noexcept { return this->storage.size(); }
+
+    /**
+     * @brief Returns the number of bytes in use, including alignment padding.
+     */
+    [[nodiscard]] size_t get_used_space() const noexcept { return this->used; }
+
+    /**
+     * @brief Returns the high-water mark of get_used_space().
+     */
+    [[nodiscard]] size_t get_peak_used_space() const noexcept { return this->peak; }
+
+private:
+    std::span<std::byte> storage;
+    size_t used = 0;
+    size_t peak = 0;
+};
+
+} // namespace ln
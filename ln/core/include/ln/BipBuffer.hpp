@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace ln {
+
+/**
+ * @brief Bip-buffer interface/manager for externally provided storage.
+ *
+ * A circular buffer variant that never splits a region across the end of
+ * storage: both reserve() and readable_span() always return a single
+ * contiguous block. Data lives in region A and, once space after A runs out,
+ * in region B at the beginning of storage. B becomes A when A is consumed.
+ * The price is that space at the end of storage may stay unused while B is
+ * active.
+ *
+ * Typical use: reserve() a frame, fill it, commit() it; readable_span() the
+ * oldest data, process it, consume() it.
+ */
+template <typename T> class BipBufferView {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "BipBufferView requires trivially destructible T for embedded safety");
+
+public:
+    /**
+     * @brief Construct a bip-buffer over the given span.
+     *
+     * The size of the span defines the capacity of the bip-buffer.
+     */
+    explicit BipBufferView(std::span<T> backing_storage) noexcept : storage(backing_storage) {}
+
+    /**
+     * @brief Returns the number of committed elements stored in the buffer.
+     */
+    [[nodiscard]] size_t size() const noexcept { return (this->a_end - this->a_start) + this->b_end; }
+
+    /**
+     * @brief Returns the capacity of the buffer.
+     */
+    [[nodiscard]] size_t capacity() const noexcept { return this->storage.size(); }
+
+    /**
+     * @brief Returns true if no committed elements are stored.
+     */
+    [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
+
+    /**
+     * @brief Remove all elements and drop a pending reservation.
+     */
+    void clear() noexcept {
+        this->a_start = 0;
+        this->a_end = 0;
+        this->b_end = 0;
+        this->b_in_use = false;
+        this->reserved_start = 0;
+        this->reserved_size = 0;
+    }
+
+    /**
+     * @brief Reserve a contiguous region of exactly count elements. A new
+     * reservation replaces a pending one.
+     *
+     * @return The reserved region, or an empty span if no contiguous region
+     * of that size is free.
+     */
+    [[nodiscard]] std::span<T> reserve(size_t count) noexcept {
+        this->reserved_size = 0;
+        if (count == 0) {
+            return {};
+        }
+        if (this->b_in_use) {
+            if (count > this->a_start - this->b_end) {
+                return {};
+            }
+            return this->make_reservation(this->b_end, count);
+        }
+        if (this->a_start == this->a_end) {
+            this->a_start = 0;
+            this->a_end = 0;
+        }
+        if (count <= this->capacity() - this->a_end) {
+            return this->make_reservation(this->a_end, count);
+        }
+        if (count <= this->a_start) {
+            return this->make_reservation(0, count);
+        }
+        return {};
+    }
+
+    /**
+     * @brief Commit the first count elements of the pending reservation and
+     * release the rest of it. commit(0) cancels the reservation.
+     *
+     * @return false if count exceeds the reserved size.
+     */
+    bool commit(size_t count) noexcept {
+        if (count > this->reserved_size) {
+            return false;
+        }
+        if (this->reserved_start == this->a_end) {
+            this->a_end += count;
+        }
+        else {
+            this->b_end += count;
+            this->b_in_use = this->b_in_use || count > 0;
+            this->promote_b_if_a_drained();
+        }
+        this->reserved_size = 0;
+        return true;
+    }
+
+    /**
+     * @brief Oldest committed elements as one contiguous region.
+     */
+    [[nodiscard]] std::span<T> readable_span() noexcept {
+        return this->storage.subspan(this->a_start, this->a_end - this->a_start);
+    }
+
+    [[nodiscard]] std::span<const T> readable_span() const noexcept {
+        return std::span<const T>{this->storage}.subspan(this->a_start, this->a_end - this->a_start);
+    }
+
+    /**
+     * @brief Release count oldest elements after reading them via
+     * readable_span().
+     *
+     * @return false if count exceeds the readable_span() size.
+     */
+    bool consume(size_t count) noexcept {
+        if (count > this->a_end - this->a_start) {
+            return false;
+        }
+        this->a_start += count;
+        this->promote_b_if_a_drained();
+        return true;
+    }
+
+private:
+    void promote_b_if_a_drained() noexcept {
+        if (this->a_start != this->a_end || !this->b_in_use) {
+            return;
+        }
+        this->a_start = 0;
+        this->a_end = this->b_end;
+        this->b_end = 0;
+        this->b_in_use = false;
+    }
+
+    std::span<T> make_reservation(size_t start, size_t count) noexcept {
+        this->reserved_start = start;
+        this->reserved_size = count;
+        return this->storage.subspan(start, count);
+    }
+
+    std::span<T> storage;
+    size_t a_start = 0; // region A: oldest data
+    size_t a_end = 0;
+    size_t b_end = 0; // region B: [0, b_end), newer than A
+    bool b_in_use = false;
+    size_t reserved_start = 0;
+    size_t reserved_size = 0;
+};
+
+/**
+ * @brief Owning fixed-size bip-buffer with internal static storage.
+ */
+template <typename T, size_t N> class BipBuffer : public BipBufferView<T> {
+    static_assert(N > 0, "BipBuffer capacity N must be > 0");
+
+public:
+    using Base = BipBufferView<T>;
+    BipBuffer() noexcept : Base{buffer} {}
+
+private:
+    std::array<T, N> buffer;
+};
+
+} // namespace ln
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/cache.hpp"
+#include "ln/ln.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace ln {
+
+namespace detail {
+
+/**
+ * @brief Copies trivially copyable T to or from memory another context may be
+ * writing at the same time, as relaxed atomic words, so the race is well
+ * defined. Uses the widest word that tiles T and that T is aligned for.
+ */
+template <typename T> struct RacyCopy {
+    using Word = std::conditional_t<
+        sizeof(T) % sizeof(std::uint32_t) == 0 && alignof(T) >= std::atomic_ref<std::uint32_t>::required_alignment,
+        std::uint32_t,
+        std::conditional_t<sizeof(T) % sizeof(std::uint16_t) == 0 &&
+                               alignof(T) >= std::atomic_ref<std::uint16_t>::required_alignment,
+                           std::uint16_t, unsigned char>>;
+    static_assert(std::atomic_ref<Word>::is_always_lock_free);
+    static constexpr size_t words_per_element = sizeof(T) / sizeof(Word);
+
+    /**
+     * @brief Copy count elements from from into shared memory to.
+     */
+    static void store(T *to, const T *from, size_t count) noexcept {
+        auto *words = reinterpret_cast<Word *>(to);
+        const auto *bytes = reinterpret_cast<const std::byte *>(from);
+        for (size_t i = 0; i < count * words_per_element; ++i) {
+            Word word;
+            std::memcpy(&word, bytes + i * sizeof(Word), sizeof(Word));
+            std::atomic_ref<Word>{words[i]}.store(word, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Copy count elements from shared memory from into to.
+     */
+    static void load(T *to, const T *from, size_t count) noexcept {
+        // atomic_ref needs a non-const referent, loads never write through it
+        auto *words = reinterpret_cast<Word *>(const_cast<T *>(from));
+        auto *bytes = reinterpret_cast<std::byte *>(to);
+        for (size_t i = 0; i < count * words_per_element; ++i) {
+            const Word word = std::atomic_ref<Word>{words[i]}.load(std::memory_order_relaxed);
+            std::memcpy(bytes + i * sizeof(Word), &word, sizeof(Word));
+        }
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Single-writer, multi-reader broadcast ring buffer interface for
+ * externally provided storage.
+ *
+ * The writer always succeeds and overwrites the oldest elements when the
+ * buffer is full, like RingBufferView::PushMode::overwrite. It does not know
+ * about readers: each Reader keeps its own cursor, so any number of them can
+ * consume the same stream without copying it, and one that falls behind by
+ * more than the capacity learns exactly how many elements it lost.
+ *
+ * Positions are free-running sequence numbers of type size_t, which may wrap
+ * around. The writer announces a range before overwriting it (claimed) and
+ * publishes it afterwards (written); a reader copies data out and then checks
+ * claimed to drop whatever the writer overwrote in the meantime, so readers
+ * never block the writer and need no critical section. Elements are copied in
+ * and out as relaxed atomic words, so those racing copies are well defined,
+ * as in SeqLock.
+ *
+ * @note Capacity must be a power of two. Only one context may write at a
+ * time.
+ */
+template <typename T> class BroadcastRingView {
+    static_assert(std::is_trivially_copyable<T>::value, "BroadcastRingView requires trivially copyable T");
+    static_assert(std::atomic<size_t>::is_always_lock_free, "BroadcastRingView requires lock-free size_t atomics");
+
+public:
+    /**
+     * @brief Construct a broadcast ring over the given span.
+     *
+     * The size of the span defines the capacity and must be a power of two.
+     */
+    explicit BroadcastRingView(std::span<T> backing_storage) noexcept : storage(backing_storage) {
+        LN_ASSERT_PANIC(std::has_single_bit(backing_storage.size()));
+    }
+
+    BroadcastRingView(const BroadcastRingView &) = delete;
+    BroadcastRingView &operator=(const BroadcastRingView &) = delete;
+
+    /**
+     * @brief Returns the capacity of the buffer.
+     */
+    [[nodiscard]] size_t capacity() const noexcept { return this->storage.size(); }
+
+    /**
+     * @brief Returns the sequence number of the next element to be written,
+     * i.e. the number of elements written so far, modulo size_t range.
+     */
+    [[nodiscard]] size_t sequence() const noexcept { return this->written.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Push an element, overwriting the oldest one if the buffer is full.
+     * Writer only.
+     */
+    void push(const T &value) noexcept { this->push(std::span<const T>{&value, 1}); }
+
+    /**
+     * @brief Push all elements, overwriting the oldest ones if the buffer is
+     * full. If values is longer than the capacity, only its last capacity()
+     * elements are stored, but all of them count towards sequence(). Writer
+     * only.
+     */
+    void push(std::span<const T> values) noexcept {
+        if (values.empty()) {
+            return;
+        }
+        const size_t end = this->written.load(std::memory_order_relaxed) + values.size();
+        if (values.size() > this->capacity()) {
+            values = values.last(this->capacity());
+        }
+        this->claimed.store(end, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        const size_t start = this->wrap(end - values.size());
+        const size_t first_chunk_size = std::min(values.size(), this->capacity() - start);
+        Copy::store(&this->storage[start], values.data(), first_chunk_size);
+        Copy::store(this->storage.data(), values.data() + first_chunk_size, values.size() - first_chunk_size);
+        this->written.store(end, std::memory_order_release);
+    }
+
+    /**
+     * @brief Outcome of a Reader::read() call.
+     */
+    struct ReadResult {
+        size_t count; ///< number of elements copied out
+        size_t lost;  ///< number of elements overwritten before this reader got to them
+    };
+
+    /**
+     * @brief Independent read cursor into a broadcast ring. Each consumer
+     * context owns one; the ring does not track them.
+     */
+    class Reader {
+    public:
+        enum class Start {
+            latest, ///< only elements pushed after the reader is created
+            oldest  ///< every element still held by the ring
+        };
+
+        explicit Reader(const BroadcastRingView &ring, Start start = Start::latest) noexcept
+            : ring(ring), cursor(ring.sequence()) {
+            if (start == Start::oldest) {
+                this->cursor -= std::min(this->cursor, ring.capacity());
+            }
+        }
+
+        /**
+         * @brief Returns the sequence number of the next element this reader
+         * will read.
+         */
+        [[nodiscard]] size_t sequence() const noexcept { return this->cursor; }
+
+        /**
+         * @brief Returns the total number of elements this reader has lost to
+         * overruns.
+         */
+        [[nodiscard]] size_t get_lost_count() const noexcept { return this->lost_total; }
+
+        /**
+         * @brief Returns the number of elements that can be read, including
+         * ones that are about to be reported as lost.
+         */
+        [[nodiscard]] size_t available() const noexcept {
+            return std::min(this->ring.sequence() - this->cursor, this->ring.capacity());
+        }
+
+        /**
+         * @brief Copy up to out.size() oldest unread elements into out.
+         *
+         * If the writer has lapped this reader, the overwritten elements are
+         * skipped and reported in ReadResult::lost. Elements overwritten while
+         * being copied are dropped the same way, so count may be zero with
+         * data still available; just read again.
+         */
+        ReadResult read(std::span<T> out) noexcept {
+            size_t lost = 0;
+            const size_t end = this->ring.written.load(std::memory_order_acquire);
+            if (end - this->cursor > this->ring.capacity()) {
+                lost = end - this->ring.capacity() - this->cursor;
+                this->cursor += lost;
+            }
+            const size_t count = std::min(out.size(), end - this->cursor);
+            const size_t start = this->ring.wrap(this->cursor);
+            const size_t first_chunk_size = std::min(count, this->ring.capacity() - start);
+            Copy::load(out.data(), &this->ring.storage[start], first_chunk_size);
+            Copy::load(out.data() + first_chunk_size, this->ring.storage.data(), count - first_chunk_size);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const size_t claimed = this->ring.claimed.load(std::memory_order_relaxed);
+            size_t overwritten = 0;
+            if (claimed - this->cursor > this->ring.capacity()) {
+                overwritten = std::min(claimed - this->ring.capacity() - this->cursor, count);
+                std::copy(out.begin() + overwritten, out.begin() + count, out.begin());
+            }
+            this->cursor += count;
+            lost += overwritten;
+            this->lost_total += lost;
+            return {count - overwritten, lost};
+        }
+
+    private:
+        const BroadcastRingView &ring;
+        size_t cursor;
+        size_t lost_total = 0;
+    };
+
+private:
+    using Copy = detail::RacyCopy<T>;
+
+    [[nodiscard]] size_t wrap(size_t sequence) const noexcept { return sequence & (this->capacity() - 1); }
+
+    std::span<T> storage;
+    alignas(cache_line_size) std::atomic<size_t> claimed{0}; // end of range being overwritten
+    std::atomic<size_t> written{0};                          // end of published range
+};
+
+/**
+ * @brief Owning fixed-size broadcast ring with internal static storage.
+ */
+template <typename T, size_t N> class BroadcastRing : public BroadcastRingView<T> {
+    static_assert(std::has_single_bit(N), "BroadcastRing capacity N must be a power of two");
+
+public:
+    using Base = BroadcastRingView<T>;
+    BroadcastRing() noexcept : Base{buffer} {}
+
+private:
+    std::array<T, N> buffer;
+};
+
+} // namespace ln
@@ -0,0 +1,529 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/Pool.hpp"
+#include "ln/ln.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
+
+namespace ln {
+
+class BufChain;
+
+/**
+ * @brief Pools of reference counted data segments and of the links that
+ * chain them, for BufChain.
+ *
+ * A segment holds segment_size bytes of payload and is freed when the last
+ * link referencing it is released, so several chains can share the same
+ * bytes. Both pools are lock-free BlockPools, so chains may be created and
+ * released from any context.
+ *
+ * See StaticBufPool for an owning pool.
+ */
+class BufPool {
+public:
+    BufPool(BlockPool &segments, BlockPool &links, size_t segment_size) noexcept
+        : segments(segments), links(links), segment_bytes(segment_size) {}
+
+    BufPool(const BufPool &) = delete;
+    BufPool &operator=(const BufPool &) = delete;
+
+    [[nodiscard]] size_t get_segment_size() const noexcept { return this->segment_bytes; }
+    [[nodiscard]] BlockPool::Usage get_segment_usage() const noexcept { return this->segments.get_usage(); }
+    [[nodiscard]] BlockPool::Usage get_link_usage() const noexcept { return this->links.get_usage(); }
+
+protected:
+    friend class BufChain;
+
+    struct Segment {
+        std::atomic<std::uint32_t> refs;
+    };
+
+    /// payload starts this far into a segment block
+    static constexpr size_t header_size = alignof(std::max_align_t);
+    static_assert(sizeof(Segment) <= header_size);
+
+    struct Link {
+        Link *next;
+        Segment *segment;
+        size_t offset; ///< of the referenced bytes within the payload
+        size_t length;
+    };
+
+private:
+    static std::byte *payload_of(Segment *segment) noexcept {
+        return reinterpret_cast<std::byte *>(segment) + header_size;
+    }
+
+    Segment *allocate_segment() noexcept {
+        void *block = this->segments.allocate();
+        return block ? std::construct_at(static_cast<Segment *>(block), 1u) : nullptr;
+    }
+
+    Link *allocate_link(Segment *segment, size_t offset, size_t length) noexcept {
+        void *block = this->links.allocate();
+        return block ? std::construct_at(static_cast<Link *>(block), nullptr, segment, offset, length) : nullptr;
+    }
+
+    /**
+     * @brief Free link and drop its reference to the segment.
+     */
+    void release(Link *link) noexcept {
+        Segment *segment = link->segment;
+        this->links.deallocate(link);
+        if (segment->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::destroy_at(segment);
+            this->segments.deallocate(segment);
+        }
+    }
+
+    BlockPool &segments;
+    BlockPool &links;
+    size_t segment_bytes;
+};
+
+/**
+ * @brief Owning BufPool of segment_count segments of segment_size bytes and
+ * link_count links.
+ *
+ * Each chain takes one link per segment it references; sharing or splitting
+ * a chain takes more links but no more segments.
+ */
+template <size_t segment_size, size_t segment_count, size_t link_count = 2 * segment_count>
+class StaticBufPool : public BufPool {
+    static_assert(segment_count > 0 && segment_count <= BlockPool::max_block_count,
+                  "StaticBufPool segment_count out of range");
+
+public:
+    StaticBufPool() noexcept : BufPool{segment_pool, link_pool, segment_size} {}
+
+private:
+    static constexpr size_t segment_block_size = BufPool::header_size + segment_size;
+
+    class SegmentPool : public BlockPool {
+    public:
+        SegmentPool() noexcept : BlockPool{buffer, segment_block_size, alignof(std::max_align_t)} {}
+
+    private:
+        alignas(std::max_align_t) std::array<
+            std::byte, BlockPool::get_stride(segment_block_size, alignof(std::max_align_t)) * segment_count> buffer;
+    };
+
+    SegmentPool segment_pool;
+    Pool<BufPool::Link, link_count> link_pool;
+};
+
+/**
+ * @brief Chain of byte ranges in reference counted pool segments (pbuf/mbuf
+ * like), for passing payloads between modules without copying.
+ *
+ * A payload is written once into segments from a BufPool; after that, chains
+ * only reference it. share() gives another chain over the same bytes and
+ * split() cuts a chain in two, both by taking references instead of copying.
+ * A segment returns to the pool when the last chain referencing it is gone.
+ *
+ * The chain object itself is move-only and owned by one context at a time;
+ * it can be handed over, e.g. through a queue, once it is filled.
+ *
+ * @code
+ * auto frame = ln::BufChain::allocate(pool, 512);
+ * spi.read(frame);                    // DMA straight into the segments
+ * auto copy = frame.share();          // for the logger, no bytes copied
+ * ln::BufChain payload;
+ * (void)frame.split(4, payload);      // header stays in frame
+ * file.write(payload);
+ * @endcode
+ *
+ * @note Bytes of a segment referenced by more than one chain are shared and
+ * must not be modified.
+ */
+class BufChain {
+    using Link = BufPool::Link;
+
+public:
+    BufChain() noexcept = default;
+
+    BufChain(BufChain &&other) noexcept
+        : pool(std::exchange(other.pool, nullptr)), head(std::exchange(other.head, nullptr)),
+          tail(std::exchange(other.tail, nullptr)), length(std::exchange(other.length, 0)) {}
+
+    BufChain &operator=(BufChain &&other) noexcept {
+        if (this != &other) {
+            this->clear();
+            this->pool = std::exchange(other.pool, nullptr);
+            this->head = std::exchange(other.head, nullptr);
+            this->tail = std::exchange(other.tail, nullptr);
+            this->length = std::exchange(other.length, 0);
+        }
+        return *this;
+    }
+
+    BufChain(const BufChain &) = delete;
+    BufChain &operator=(const BufChain &) = delete;
+
+    ~BufChain() { this->clear(); }
+
+    /**
+     * @brief Allocate a chain of size uninitialized bytes, to be filled
+     * through writable_segments().
+     *
+     * @return The chain, or an empty chain if the pool is exhausted.
+     */
+    [[nodiscard]] static BufChain allocate(BufPool &pool, size_t size) noexcept {
+        BufChain chain{pool};
+        (void)chain.grow(size);
+        return chain;
+    }
+
+    /**
+     * @brief Allocate a chain holding a copy of data.
+     *
+     * @return The chain, or an empty chain if the pool is exhausted.
+     */
+    [[nodiscard]] static BufChain copy_of(BufPool &pool, std::span<const std::byte> data) noexcept {
+        BufChain chain{pool};
+        (void)chain.append(data);
+        return chain;
+    }
+
+    /**
+     * @brief Returns another chain over the same bytes.
+     *
+     * @return The chain, or an empty chain if the link pool is exhausted.
+     */
+    [[nodiscard]] BufChain share() const noexcept {
+        BufChain chain{};
+        chain.pool = this->pool;
+        for (const Link *link = this->head; link; link = link->next) {
+            if (!chain.link_back(link->segment, link->offset, link->length)) {
+                chain.clear();
+                break;
+            }
+        }
+        return chain;
+    }
+
+    /**
+     * @brief Copy data to the end, filling the free room of the last segment
+     * before taking new ones. Either all of data is appended or nothing is.
+     *
+     * @return false if the pool is exhausted.
+     */
+    bool append(std::span<const std::byte> data) noexcept {
+        LN_ASSERT_PANIC(this->pool);
+        const size_t old_length = this->length;
+        if (!this->grow(data.size())) {
+            return false;
+        }
+        size_t position = 0;
+        for (std::span<std::byte> segment : this->writable_segments(old_length)) {
+            std::memcpy(segment.data(), data.data() + position, segment.size());
+            position += segment.size();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Move the links of other to the end. O(1), nothing is copied.
+     */
+    void append(BufChain &&other) noexcept {
+        if (other.empty()) {
+            return;
+        }
+        if (!this->pool) {
+            *this = std::move(other);
+            return;
+        }
+        LN_ASSERT_PANIC(this->pool == other.pool);
+        if (this->tail) {
+            this->tail->next = other.head;
+        }
+        else {
+            this->head = other.head;
+        }
+        this->tail = other.tail;
+        this->length += other.length;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.length = 0;
+    }
+
+    /**
+     * @brief Cut the chain at offset: the bytes from offset on move to tail,
+     * which is replaced. A segment cut in the middle is shared by both.
+     *
+     * @return false if offset is past the end or the link pool is exhausted;
+     * the chain is then unchanged.
+     */
+    bool split(size_t offset, BufChain &tail) noexcept {
+        if (offset > this->length) {
+            return false;
+        }
+        tail.clear();
+        tail.pool = this->pool;
+        if (offset == this->length) {
+            return true;
+        }
+        Link **link = &this->head;
+        Link *previous = nullptr;
+        size_t position = 0;
+        while (position + (*link)->length <= offset) {
+            position += (*link)->length;
+            previous = *link;
+            link = &(*link)->next;
+        }
+        Link *cut = *link;
+        const size_t kept = offset - position;
+        if (kept > 0) {
+            // both halves reference the segment
+            Link *rest = this->pool->allocate_link(cut->segment, cut->offset + kept, cut->length - kept);
+            if (!rest) {
+                return false;
+            }
+            cut->segment->refs.fetch_add(1, std::memory_order_relaxed);
+            rest->next = cut->next;
+            cut->next = nullptr;
+            cut->length = kept;
+            tail.head = rest;
+            tail.tail = rest->next ? this->tail : rest;
+            this->tail = cut;
+        }
+        else {
+            *link = nullptr;
+            tail.head = cut;
+            tail.tail = this->tail;
+            this->tail = previous;
+        }
+        tail.length = this->length - offset;
+        this->length = offset;
+        return true;
+    }
+
+    /**
+     * @brief Drop count bytes from the front, releasing the segments no
+     * longer referenced.
+     */
+    void consume(size_t count) noexcept {
+        count = std::min(count, this->length);
+        this->length -= count;
+        while (count > 0) {
+            Link *front = this->head;
+            if (count < front->length) {
+                front->offset += count;
+                front->length -= count;
+                return;
+            }
+            count -= front->length;
+            this->head = front->next;
+            if (!this->head) {
+                this->tail = nullptr;
+            }
+            this->pool->release(front);
+        }
+    }
+
+    /**
+     * @brief Copy bytes from offset on into out, e.g. to parse a header that
+     * straddles segments.
+     *
+     * @return Number of bytes copied.
+     */
+    size_t gather(std::span<std::byte> out, size_t offset = 0) const noexcept {
+        size_t copied = 0;
+        for (std::span<const std::byte> segment : this->segments()) {
+            if (copied == out.size()) {
+                break;
+            }
+            if (offset >= segment.size()) {
+                offset -= segment.size();
+                continue;
+            }
+            const size_t count = std::min(segment.size() - offset, out.size() - copied);
+            std::memcpy(out.data() + copied, segment.data() + offset, count);
+            copied += count;
+            offset = 0;
+        }
+        return copied;
+    }
+
+    /**
+     * @brief Release everything, leaving an empty chain.
+     */
+    void clear() noexcept {
+        while (this->head) {
+            this->pool->release(std::exchange(this->head, this->head->next));
+        }
+        this->tail = nullptr;
+        this->length = 0;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return this->length; }
+    [[nodiscard]] bool empty() const noexcept { return this->length == 0; }
+    [[nodiscard]] BufPool *get_pool() const noexcept { return this->pool; }
+
+    [[nodiscard]] size_t get_segment_count() const noexcept {
+        size_t count = 0;
+        for (const Link *link = this->head; link; link = link->next) {
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Range over the contiguous pieces of the chain, for scatter-gather
+     * output, e.g. one DMA transfer per segment.
+     */
+    template <typename Byte> class SegmentRange {
+    public:
+        class Iterator {
+        public:
+            using value_type = std::span<Byte>;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() noexcept = default;
+            explicit Iterator(Link *link, size_t skip) noexcept : link(link), skip(skip) {}
+
+            std::span<Byte> operator*() const noexcept {
+                return {BufPool::payload_of(this->link->segment) + this->link->offset + this->skip,
+                        this->link->length - this->skip};
+            }
+            Iterator &operator++() noexcept {
+                this->link = this->link->next;
+                this->skip = 0;
+                return *this;
+            }
+            Iterator operator++(int) noexcept {
+                Iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+            bool operator==(const Iterator &other) const noexcept { return this->link == other.link; }
+
+        private:
+            Link *link = nullptr;
+            size_t skip = 0; ///< bytes to leave out of the first segment
+        };
+
+        SegmentRange(Link *head, size_t skip) noexcept : first(head, skip) {}
+
+        [[nodiscard]] Iterator begin() const noexcept { return this->first; }
+        [[nodiscard]] Iterator end() const noexcept { return {}; }
+
+    private:
+        Iterator first;
+    };
+
+    [[nodiscard]] SegmentRange<const std::byte> segments() const noexcept { return {this->head, 0}; }
+
+    /**
+     * @brief Range over the pieces from offset on, for filling the chain,
+     * e.g. by DMA. The segments must not be shared.
+     */
+    [[nodiscard]] SegmentRange<std::byte> writable_segments(size_t offset = 0) noexcept {
+        Link *link = this->head;
+        while (link && offset >= link->length) {
+            offset -= link->length;
+            link = link->next;
+        }
+        for (Link *checked = link; checked; checked = checked->next) {
+            LN_ASSERT_PANIC(checked->segment->refs.load(std::memory_order_acquire) == 1);
+        }
+        return {link, link ? offset : 0};
+    }
+
+private:
+    explicit BufChain(BufPool &pool) noexcept : pool(&pool) {}
+
+    bool link_back(BufPool::Segment *segment, size_t offset, size_t size) noexcept {
+        Link *link = this->pool->allocate_link(segment, offset, size);
+        if (!link) {
+            return false;
+        }
+        segment->refs.fetch_add(1, std::memory_order_relaxed);
+        this->push_back(link);
+        return true;
+    }
+
+    void push_back(Link *link) noexcept {
+        if (this->tail) {
+            this->tail->next = link;
+        }
+        else {
+            this->head = link;
+        }
+        this->tail = link;
+        this->length += link->length;
+    }
+
+    /**
+     * @brief Add size uninitialized bytes at the end: first the free room of
+     * the last segment if no one else references it, then new segments.
+     * Either all are added or the chain is left as it was.
+     */
+    bool grow(size_t size) noexcept {
+        Link *const old_tail = this->tail;
+        const size_t old_tail_length = old_tail ? old_tail->length : 0;
+        const size_t old_length = this->length;
+        if (old_tail && old_tail->segment->refs.load(std::memory_order_acquire) == 1) {
+            const size_t room = this->pool->segment_bytes - (old_tail->offset + old_tail->length);
+            const size_t taken = std::min(room, size);
+            old_tail->length += taken;
+            this->length += taken;
+            size -= taken;
+        }
+        while (size > 0) {
+            BufPool::Segment *segment = this->pool->allocate_segment();
+            Link *link = segment ? this->pool->allocate_link(segment, 0, std::min(this->pool->segment_bytes, size))
+                                 : nullptr;
+            if (!link) {
+                if (segment) {
+                    this->pool->segments.deallocate(segment);
+                }
+                this->rollback(old_tail, old_tail_length, old_length);
+                return false;
+            }
+            size -= link->length;
+            this->push_back(link);
+        }
+        return true;
+    }
+
+    void rollback(Link *old_tail, size_t old_tail_length, size_t old_length) noexcept {
+        Link *added = old_tail ? old_tail->next : this->head;
+        while (added) {
+            this->pool->release(std::exchange(added, added->next));
+        }
+        if (old_tail) {
+            old_tail->next = nullptr;
+            old_tail->length = old_tail_length;
+        }
+        else {
+            this->head = nullptr;
+        }
+        this->tail = old_tail;
+        this->length = old_length;
+    }
+
+    BufPool *pool = nullptr;
+    Link *head = nullptr;
+    Link *tail = nullptr;
+    size_t length = 0;
+};
+
+} // namespace ln
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/InplaceFunction.hpp"
+#include "ln/MpscQueue.hpp"
+#include "ln/Pool.hpp"
+#include "ln/StaticForwardList.hpp"
+#include "ln/ln.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace ln {
+
+/**
+ * @brief Runs work posted from ISRs and tasks later, on a worker per priority
+ * level (bottom halves).
+ *
+ * post() is O(1) and lock-free, so it is safe from any context: it takes a
+ * work item from a fixed pool, moves the closure into it, appends it to the
+ * level's MpscQueue and calls ll_notify() to wake the level's worker. The
+ * worker calls run_pending(), which executes the queued work in order.
+ * Closures live inline in the work items, up to work_size bytes each, so
+ * nothing is allocated from the heap.
+ *
+ * Each work item is stamped with ll_timestamp() when posted. run_pending()
+ * records the time it waited before running, see Stats.
+ *
+ * Derived classes provide the workers, see ln::drivers::TaskDeferredExecutor
+ * for one FreeRTOS task per level.
+ */
+template <size_t level_count, size_t capacity, size_t work_size = 4 * sizeof(void *)> class DeferredExecutor {
+    static_assert(level_count > 0, "DeferredExecutor needs at least one level");
+
+public:
+    using Work = InplaceFunction<void(), work_size>;
+
+    struct Stats {
+        size_t posted;              ///< work items queued
+        size_t executed;            ///< work items run
+        size_t failed;              ///< post() calls that found the work item pool exhausted
+        std::uint32_t last_latency; ///< ll_timestamp() ticks between posting and running the last item
+        std::uint32_t max_latency;  ///< high-water mark of last_latency
+    };
+
+    DeferredExecutor() noexcept = default;
+    DeferredExecutor(const DeferredExecutor &) = delete;
+    DeferredExecutor &operator=(const DeferredExecutor &) = delete;
+    virtual ~DeferredExecutor() = default;
+
+    /**
+     * @brief Queue fn to run on the worker of level. Safe from any context.
+     *
+     * @return false if no work item is free, fn is then dropped.
+     */
+    template <typename F> bool post(size_t level, F &&fn) noexcept {
+        LN_ASSERT_PANIC(level < level_count);
+        Level &target = this->levels[level];
+        Item *item = this->items.create(std::forward<F>(fn), this->ll_timestamp());
+        if (!item) {
+            target.failed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        target.posted.fetch_add(1, std::memory_order_relaxed);
+        target.queue.push(*item);
+        this->ll_notify(level);
+        return true;
+    }
+
+    /**
+     * @brief Run the work queued on level. Call from the level's worker only.
+     *
+     * @return Number of work items run.
+     */
+    size_t run_pending(size_t level) noexcept {
+        LN_ASSERT_PANIC(level < level_count);
+        Level &target = this->levels[level];
+        size_t executed = 0;
+        while (Item *item = target.queue.pop()) {
+            const std::uint32_t latency = this->ll_timestamp() - item->posted_at;
+            target.last_latency.store(latency, std::memory_order_relaxed);
+            if (latency > target.max_latency.load(std::memory_order_relaxed)) {
+                target.max_latency.store(latency, std::memory_order_relaxed);
+            }
+            item->work();
+            this->items.destroy(item);
+            target.executed.fetch_add(1, std::memory_order_relaxed);
+            ++executed;
+        }
+        return executed;
+    }
+
+    [[nodiscard]] Stats get_stats(size_t level) const noexcept {
+        LN_ASSERT_PANIC(level < level_count);
+        const Level &target = this->levels[level];
+        return {target.posted.load(std::memory_order_relaxed), target.executed.load(std::memory_order_relaxed),
+                target.failed.load(std::memory_order_relaxed), target.last_latency.load(std::memory_order_relaxed),
+                target.max_latency.load(std::memory_order_relaxed)};
+    }
+
+    /**
+     * @brief Usage of the work item pool shared by all levels.
+     */
+    [[nodiscard]] BlockPool::Usage get_usage() const noexcept { return this->items.get_usage(); }
+
+    [[nodiscard]] static constexpr size_t get_level_count() noexcept { return level_count; }
+
+protected:
+    /**
+     * @brief Wake the worker of level. Called from post(), in any context.
+     */
+    virtual void ll_notify(size_t level) = 0;
+
+    /**
+     * @brief Returns a free-running timestamp used to measure latency. Called
+     * from post(), in any context.
+     */
+    virtual std::uint32_t ll_timestamp() = 0;
+
+private:
+    struct Item : StaticForwardListNode<Item> {
+        template <typename F>
+        Item(F &&fn, std::uint32_t posted_at) noexcept : work(std::forward<F>(fn)), posted_at(posted_at) {}
+
+        Work work;
+        std::uint32_t posted_at;
+    };
+
+    struct Level {
+        MpscQueue<Item> queue;
+        std::atomic<size_t> posted{0};
+        std::atomic<size_t> executed{0};
+        std::atomic<size_t> failed{0};
+        std::atomic<std::uint32_t> last_latency{0};
+        std::atomic<std::uint32_t> max_latency{0};
+    };
+
+    Pool<Item, capacity> items;
+    std::array<Level, level_count> levels{};
+};
+
+} // namespace ln
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/InplaceFunction.hpp"
+#include "ln/Pool.hpp"
+#include "ln/ln.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace ln {
+
+class EventBus;
+template <typename T> class Subscriber;
+template <typename T, size_t slot_count> class Topic;
+
+/**
+ * @brief Shared reference to a published message. Move-only; the message
+ * slot returns to its topic's pool when the last reference is gone.
+ */
+template <typename T> class MessageRef {
+public:
+    MessageRef() noexcept = default;
+
+    MessageRef(MessageRef &&other) noexcept : message(std::exchange(other.message, nullptr)) {}
+    MessageRef &operator=(MessageRef &&other) noexcept {
+        if (this != &other) {
+            this->reset();
+            this->message = std::exchange(other.message, nullptr);
+        }
+        return *this;
+    }
+
+    MessageRef(const MessageRef &) = delete;
+    MessageRef &operator=(const MessageRef &) = delete;
+
+    ~MessageRef() { this->reset(); }
+
+    explicit operator bool() const noexcept { return this->message != nullptr; }
+    const T &operator*() const noexcept { return this->message->value; }
+    const T *operator->() const noexcept { return &this->message->value; }
+
+    void reset() noexcept {
+        if (this->message) {
+            release(std::exchange(this->message, nullptr));
+        }
+    }
+
+private:
+    template <typename, size_t> friend class Topic;
+    friend class Subscriber<T>;
+
+    struct Message {
+        template <typename... Args>
+        Message(BlockPool &pool, std::uint32_t published_at, Args &&...args) noexcept
+            : value(std::forward<Args>(args)...), pool(pool), published_at(published_at) {}
+
+        T value;
+        BlockPool &pool;
+        std::uint32_t published_at;
+        std::atomic<std::uint32_t> refs{1};
+    };
+
+    explicit MessageRef(Message *message) noexcept : message(message) {}
+
+    static void release(Message *message) noexcept {
+        if (message->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            BlockPool &pool = message->pool;
+            std::destroy_at(message);
+            pool.deallocate(message);
+        }
+    }
+
+    Message *message = nullptr;
+};
+
+/**
+ * @brief Type-independent part of a topic: its name, statistics and the
+ * clock of its bus.
+ */
+class TopicBase {
+public:
+    struct Stats {
+        size_t published;            ///< messages published
+        size_t dropped;              ///< publishes that found the slot pool exhausted
+        size_t overwritten;          ///< messages replaced before a subscriber took them
+        std::uint32_t last_latency;  ///< EventBus::ll_timestamp() ticks from publishing to the last take
+        std::uint32_t max_latency;   ///< high-water mark of last_latency
+    };
+
+    TopicBase(EventBus &bus, const char *name) noexcept;
+
+    TopicBase(const TopicBase &) = delete;
+    TopicBase &operator=(const TopicBase &) = delete;
+
+    [[nodiscard]] const char *get_name() const noexcept { return this->name; }
+
+    [[nodiscard]] Stats get_stats() const noexcept {
+        return {this->published.load(std::memory_order_relaxed), this->dropped.load(std::memory_order_relaxed),
+                this->overwritten.load(std::memory_order_relaxed), this->last_latency.load(std::memory_order_relaxed),
+                this->max_latency.load(std::memory_order_relaxed)};
+    }
+
+    /**
+     * @brief Returns the next topic registered on the same bus, see
+     * EventBus::get_first_topic().
+     */
+    [[nodiscard]] const TopicBase *get_next() const noexcept { return this->next; }
+
+protected:
+    std::uint32_t timestamp() noexcept;
+
+    void record_latency(std::uint32_t published_at) noexcept {
+        const std::uint32_t latency = this->timestamp() - published_at;
+        this->last_latency.store(latency, std::memory_order_relaxed);
+        std::uint32_t observed = this->max_latency.load(std::memory_order_relaxed);
+        while (latency > observed &&
+               !this->max_latency.compare_exchange_weak(observed, latency, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::atomic<size_t> published{0};
+    std::atomic<size_t> dropped{0};
+    std::atomic<size_t> overwritten{0};
+
+private:
+    template <typename> friend class Subscriber;
+
+    EventBus &bus;
+    const char *name;
+    const TopicBase *next = nullptr;
+    std::atomic<std::uint32_t> last_latency{0};
+    std::atomic<std::uint32_t> max_latency{0};
+};
+
+/**
+ * @brief Receives the messages of one topic, keeping only the newest one.
+ *
+ * Each publish replaces whatever the subscriber has not taken yet and calls
+ * the notify callback, in the publisher's context, so it must be ISR-safe if
+ * the topic is published from an ISR, e.g. a task notification given with
+ * notifyGiveFromISR(). take() is for the subscriber's own context only.
+ *
+ * @note There is no unsubscribe: a subscribed Subscriber must have exactly
+ * the lifetime of its topic, e.g. both with static storage duration, or both
+ * in one scope with the subscriber declared after the topic and nothing
+ * published while they are destroyed. A subscriber destroyed first leaves a
+ * dangling node in the topic, one destroyed last releases its message into
+ * the destroyed topic's pool. Messages taken with take() must be released
+ * before the topic is destroyed too.
+ */
+template <typename T> class Subscriber {
+public:
+    using Notify = InplaceFunction<void()>;
+
+    explicit Subscriber(Notify notify = nullptr) noexcept : notify(std::move(notify)) {}
+
+    Subscriber(const Subscriber &) = delete;
+    Subscriber &operator=(const Subscriber &) = delete;
+
+    ~Subscriber() {
+        if (auto *message = this->mailbox.exchange(nullptr, std::memory_order_acquire)) {
+            MessageRef<T>::release(message);
+        }
+    }
+
+    /**
+     * @brief Take the newest message published since the last take.
+     *
+     * @return The message, or an empty reference if there is none.
+     */
+    [[nodiscard]] MessageRef<T> take() noexcept {
+        auto *message = this->mailbox.exchange(nullptr, std::memory_order_acquire);
+        if (message) {
+            this->topic->record_latency(message->published_at);
+        }
+        return MessageRef<T>{message};
+    }
+
+    [[nodiscard]] bool has_message() const noexcept {
+        return this->mailbox.load(std::memory_order_relaxed) != nullptr;
+    }
+
+private:
+    template <typename, size_t> friend class Topic;
+    using Message = typename MessageRef<T>::Message;
+
+    std::atomic<Message *> mailbox{nullptr};
+    Notify notify;
+    TopicBase *topic = nullptr;
+    Subscriber *next = nullptr;
+};
+
+/**
+ * @brief Typed topic with slot_count message slots.
+ *
+ * publish() is lock-free and safe from any context, ISRs included: it builds
+ * the message once in a pool slot, hands every subscriber a reference to it
+ * and wakes them. Subscribers read the message in place, so a large struct
+ * is never copied after it is published. A slot is free again once every
+ * subscriber has moved on to a newer message and dropped its reference.
+ *
+ * Give slot_count at least one slot per subscriber, to hold the message it
+ * is reading, one for the newest message waiting in the mailboxes, and one
+ * per context that may be publishing at the same time; publish() fails and
+ * counts a drop when the pool is exhausted. E.g. one subscriber and one
+ * publishing context need 3 slots.
+ *
+ * @code
+ * ln::Topic<ImuFrame, 4> imu_topic{bus, "imu"};
+ * ln::Subscriber<ImuFrame> fusion{[] { fusion_task.notifyGive(); }};
+ * imu_topic.subscribe(fusion);
+ *
+ * imu_topic.publish(frame); // from the IMU data ready ISR
+ * if (auto frame = fusion.take()) { update(*frame); }
+ * @endcode
+ */
+template <typename T, size_t slot_count> class Topic : public TopicBase {
+public:
+    using Message = typename MessageRef<T>::Message;
+
+    Topic(EventBus &bus, const char *name) noexcept : TopicBase(bus, name) {}
+
+    /**
+     * @brief Register subscriber for the rest of the topic's lifetime, see
+     * Subscriber. Safe to race with publish(), not with another subscribe().
+     */
+    void subscribe(Subscriber<T> &subscriber) noexcept {
+        LN_ASSERT_PANIC(!subscriber.topic);
+        subscriber.topic = this;
+        subscriber.next = this->subscribers.load(std::memory_order_relaxed);
+        this->subscribers.store(&subscriber, std::memory_order_release);
+    }
+
+    /**
+     * @brief Publish a copy of value. Safe from any context.
+     *
+     * @return false if no message slot is free; the value is dropped.
+     */
+    bool publish(const T &value) noexcept { return this->emplace(value); }
+
+    /**
+     * @brief Publish a message constructed in place from args. Safe from any
+     * context.
+     *
+     * @return false if no message slot is free; nothing is published.
+     */
+    template <typename... Args> bool emplace(Args &&...args) noexcept {
+        Message *message = this->slots.create(this->slots, this->timestamp(), std::forward<Args>(args)...);
+        if (!message) {
+            this->dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        this->published.fetch_add(1, std::memory_order_relaxed);
+        // the publisher's own reference keeps the message alive while delivering
+        for (Subscriber<T> *subscriber = this->subscribers.load(std::memory_order_acquire); subscriber;
+             subscriber = subscriber->next) {
+            message->refs.fetch_add(1, std::memory_order_relaxed);
+            if (Message *replaced = subscriber->mailbox.exchange(message, std::memory_order_acq_rel)) {
+                this->overwritten.fetch_add(1, std::memory_order_relaxed);
+                MessageRef<T>::release(replaced);
+            }
+            if (subscriber->notify) {
+                subscriber->notify();
+            }
+        }
+        MessageRef<T>::release(message);
+        return true;
+    }
+
+    /**
+     * @brief Usage of the message slots.
+     */
+    [[nodiscard]] BlockPool::Usage get_usage() const noexcept { return this->slots.get_usage(); }
+
+private:
+    Pool<Message, slot_count> slots;
+    std::atomic<Subscriber<T> *> subscribers{nullptr};
+};
+
+/**
+ * @brief Registry of topics sharing a clock for latency measurement.
+ *
+ * Topics register themselves on construction and can be listed through
+ * get_first_topic(), e.g. to print their statistics. Derived classes provide
+ * the clock.
+ */
+class EventBus {
+public:
+    EventBus() noexcept = default;
+    EventBus(const EventBus &) = delete;
+    EventBus &operator=(const EventBus &) = delete;
+    virtual ~EventBus() = default;
+
+    [[nodiscard]] const TopicBase *get_first_topic() const noexcept { return this->topics; }
+
+protected:
+    /**
+     * @brief Returns a free-running timestamp used to measure latency. Called
+     * from publish() and take(), in any context.
+     */
+    virtual std::uint32_t ll_timestamp() = 0;
+
+private:
+    friend class TopicBase;
+
+    const TopicBase *topics = nullptr;
+};
+
+inline TopicBase::TopicBase(EventBus &bus, const char *name) noexcept : bus(bus), name(name) {
+    this->next = std::exchange(bus.topics, this);
+}
+
+inline std::uint32_t TopicBase::timestamp() noexcept { return this->bus.ll_timestamp(); }
+
+} // namespace ln
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "ln/BufChain.hpp"
 #include "ln/ln.h"
 
 #include <cstdio>
@@ -57,6 +58,20 @@ public:
 
     FILE *c_file() { return this->file.get(); }
 
+    /**
+     * @brief Write every segment of chain in turn, without gathering it first.
+     *
+     * @return true if all bytes were written.
+     */
+    bool write(const BufChain &chain) {
+        for (std::span<const std::byte> segment : chain.segments()) {
+            if (fwrite(segment.data(), 1, segment.size(), this->file.get()) != segment.size()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     ~File() = default;
 
 private:
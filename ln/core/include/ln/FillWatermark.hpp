@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace ln {
+
+/**
+ * @brief Fill level of a buffer at which its consumer is woken, and the
+ * decision of when to wake it.
+ *
+ * A producer wakes the consumer only when its push takes the fill level from
+ * below the watermark to at or above it, so a stream of N elements costs
+ * about N / watermark wakeups instead of N. Holds no lock; the owner calls it
+ * with the buffer already locked, see ln::drivers::WatermarkRingBuffer.
+ */
+class FillWatermark {
+public:
+    /**
+     * @param level Fill level that wakes the consumer, clamped to
+     * [1, capacity].
+     */
+    FillWatermark(size_t capacity, size_t level) noexcept : capacity(capacity) { (void)this->set_level(level, 0); }
+
+    /**
+     * @brief Change the level.
+     *
+     * @param size Current fill level.
+     * @return true if size already reaches the new level but did not reach
+     * the old one, i.e. the consumer must be woken now as no push will cross
+     * it.
+     */
+    bool set_level(size_t level, size_t size) noexcept {
+        const bool was_reached = this->reached(size);
+        this->level = std::clamp<size_t>(level, 1, std::max<size_t>(this->capacity, 1));
+        return !was_reached && this->reached(size);
+    }
+
+    [[nodiscard]] size_t get_level() const noexcept { return this->level; }
+
+    /**
+     * @brief Returns true if size is at or above the level.
+     */
+    [[nodiscard]] bool reached(size_t size) const noexcept { return size >= this->level; }
+
+    /**
+     * @brief Returns true if a push that took the fill level from size_before
+     * to size_after must wake the consumer.
+     */
+    [[nodiscard]] bool crossed(size_t size_before, size_t size_after) const noexcept {
+        return !this->reached(size_before) && this->reached(size_after);
+    }
+
+private:
+    size_t capacity;
+    size_t level = 1;
+};
+
+} // namespace ln
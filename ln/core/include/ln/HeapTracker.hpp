@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace ln {
+
+/**
+ * @brief Attributes heap allocations to their call sites.
+ *
+ * Sits between an allocation function and its backing allocator: the wrapper
+ * requests overhead extra bytes, passes the block to on_allocate() together
+ * with the caller's return address and hands out the pointer it returns. On
+ * free, on_deallocate() gives back the block to release. The size and call
+ * site live in a small header in front of each allocation, so both calls are
+ * O(1) apart from a probe of the fixed call site table.
+ *
+ * Call sites that do not fit into the table are lumped together and counted
+ * in Totals::untracked_count.
+ *
+ * @note Not thread-safe, the wrapper serializes access.
+ */
+class HeapTracker {
+public:
+    struct Site {
+        const void *caller = nullptr; ///< return address of the allocating call
+        size_t live_count = 0;        ///< allocations not yet freed
+        size_t live_size = 0;         ///< bytes requested by live allocations
+        size_t peak_size = 0;         ///< high-water mark of live_size
+        size_t allocation_count = 0;  ///< allocations ever made, much more than live_count means churn
+    };
+
+    struct Totals {
+        size_t live_count;
+        size_t live_size;
+        size_t peak_size;
+        size_t allocation_count;
+        size_t site_count;      ///< distinct call sites in the table
+        size_t untracked_count; ///< allocations whose call site did not fit into the table
+    };
+
+    enum class Order { live_size, allocation_count };
+
+    /**
+     * @brief Extra bytes to allocate in front of every tracked block; keeps
+     * the alignment of the backing allocator up to std::max_align_t.
+     */
+    static constexpr size_t overhead = (sizeof(size_t) * 2 + alignof(std::max_align_t) - 1) /
+                                       alignof(std::max_align_t) * alignof(std::max_align_t);
+
+    constexpr explicit HeapTracker(std::span<Site> sites) noexcept : sites(sites) {}
+
+    HeapTracker(const HeapTracker &) = delete;
+    HeapTracker &operator=(const HeapTracker &) = delete;
+
+    /**
+     * @brief Record an allocation of size bytes made from caller.
+     *
+     * @param block Block of size + overhead bytes from the backing allocator,
+     * or nullptr if it failed.
+     * @return Pointer to hand out, nullptr if block is nullptr.
+     */
+    [[nodiscard]] void *on_allocate(void *block, size_t size, const void *caller) noexcept {
+        if (!block) {
+            return nullptr;
+        }
+        const size_t index = this->find_or_insert(caller);
+        std::construct_at(static_cast<Header *>(block), Header{size, index});
+
+        Site &site = this->site_at(index);
+        ++site.live_count;
+        site.live_size += size;
+        site.peak_size = std::max(site.peak_size, site.live_size);
+        ++site.allocation_count;
+
+        ++this->live_count;
+        this->live_size += size;
+        this->peak_size = std::max(this->peak_size, this->live_size);
+        ++this->allocation_count;
+        return static_cast<std::byte *>(block) + overhead;
+    }
+
+    /**
+     * @brief Record the release of a pointer obtained from on_allocate().
+     *
+     * @return Block to return to the backing allocator, nullptr if pointer is
+     * nullptr.
+     */
+    [[nodiscard]] void *on_deallocate(void *pointer) noexcept {
+        if (!pointer) {
+            return nullptr;
+        }
+        void *block = static_cast<std::byte *>(pointer) - overhead;
+        const Header header = *static_cast<const Header *>(block);
+
+        Site &site = this->site_at(header.site);
+        --site.live_count;
+        site.live_size -= header.size;
+
+        --this->live_count;
+        this->live_size -= header.size;
+        return block;
+    }
+
+    /**
+     * @brief Record that a pointer obtained from on_allocate() now holds only
+     * size bytes, at most its current size, e.g. after an in-place shrink.
+     */
+    void on_shrink(void *pointer, size_t size) noexcept {
+        auto *header = reinterpret_cast<Header *>(static_cast<std::byte *>(pointer) - overhead);
+        const size_t released = header->size - size;
+        header->size = size;
+        this->site_at(header->site).live_size -= released;
+        this->live_size -= released;
+    }
+
+    /**
+     * @brief Returns the size requested for a pointer obtained from
+     * on_allocate().
+     */
+    [[nodiscard]] static size_t get_size(const void *pointer) noexcept {
+        const auto *block = static_cast<const std::byte *>(pointer) - overhead;
+        return reinterpret_cast<const Header *>(block)->size;
+    }
+
+    [[nodiscard]] Totals get_totals() const noexcept {
+        return {this->live_count,       this->live_size,  this->peak_size,
+                this->allocation_count, this->site_count, this->untracked.allocation_count};
+    }
+
+    /**
+     * @brief Copy the call sites with the most live bytes (or the most
+     * allocations) into out, largest first.
+     *
+     * @return Number of sites copied.
+     */
+    size_t get_top_sites(std::span<Site> out, Order order = Order::live_size) const noexcept {
+        const auto greater = [order](const Site &a, const Site &b) {
+            if (order == Order::allocation_count) {
+                return a.allocation_count > b.allocation_count;
+            }
+            return a.live_size != b.live_size ? a.live_size > b.live_size : a.allocation_count > b.allocation_count;
+        };
+        // empty slots have no allocations and sort last
+        std::partial_sort_copy(this->sites.begin(), this->sites.end(), out.begin(), out.end(), greater);
+        return std::min(out.size(), this->site_count);
+    }
+
+    /**
+     * @brief Restart peak tracking from the current live sizes.
+     */
+    void reset_peaks() noexcept {
+        for (Site &site : this->sites) {
+            site.peak_size = site.live_size;
+        }
+        this->untracked.peak_size = this->untracked.live_size;
+        this->peak_size = this->live_size;
+    }
+
+private:
+    struct Header {
+        size_t size;
+        size_t site; ///< index into sites, sites.size() for untracked
+    };
+    static_assert(sizeof(Header) <= overhead);
+
+    Site &site_at(size_t index) noexcept { return index < this->sites.size() ? this->sites[index] : this->untracked; }
+
+    /**
+     * @brief Returns the table index of caller, adding it if there is room.
+     * Sites are never removed, so a linear probe ends at the first empty slot.
+     */
+    size_t find_or_insert(const void *caller) noexcept {
+        if (!caller || this->sites.empty()) {
+            return this->sites.size();
+        }
+        const auto address = reinterpret_cast<std::uintptr_t>(caller);
+        size_t index = static_cast<size_t>((address >> 1) * 2654435761U) % this->sites.size();
+        for (size_t probe = 0; probe < this->sites.size(); ++probe) {
+            Site &site = this->sites[index];
+            if (site.caller == caller) {
+                return index;
+            }
+            if (!site.caller) {
+                site.caller = caller;
+                ++this->site_count;
+                return index;
+            }
+            index = index + 1 < this->sites.size() ? index + 1 : 0;
+        }
+        return this->sites.size();
+    }
+
+    std::span<Site> sites;
+    Site untracked{};
+    size_t site_count = 0;
+    size_t live_count = 0;
+    size_t live_size = 0;
+    size_t peak_size = 0;
+    size_t allocation_count = 0;
+};
+
+/**
+ * @brief HeapTracker with a table of N call sites.
+ */
+template <size_t N> class StaticHeapTracker : public HeapTracker {
+public:
+    constexpr StaticHeapTracker() noexcept : HeapTracker{table} {}
+
+private:
+    std::array<Site, N> table{};
+};
+
+} // namespace ln
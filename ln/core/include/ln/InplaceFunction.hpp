@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/ln.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ln {
+
+template <typename Signature, size_t capacity = 4 * sizeof(void *)> class InplaceFunction;
+
+/**
+ * @brief Move-only type-erased callable stored inline in capacity bytes.
+ *
+ * A drop-in for std::function where the heap is off limits: callables that
+ * do not fit, or that need stricter alignment than std::max_align_t, are
+ * rejected at compile time instead of being allocated. Calling an empty
+ * InplaceFunction panics.
+ */
+template <typename R, typename... Args, size_t capacity> class InplaceFunction<R(Args...), capacity> {
+public:
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    template <typename F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction> && std::is_invocable_r_v<R, F &, Args...>)
+    InplaceFunction(F &&fn) noexcept {
+        using Callable = std::decay_t<F>;
+        static_assert(sizeof(Callable) <= capacity, "callable does not fit into InplaceFunction capacity");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t), "callable is over-aligned");
+        static_assert(std::is_nothrow_move_constructible_v<Callable>, "callable must be nothrow move constructible");
+        std::construct_at(reinterpret_cast<Callable *>(this->storage), std::forward<F>(fn));
+        this->ops = &ops_for<Callable>;
+    }
+
+    InplaceFunction(InplaceFunction &&other) noexcept { this->take(other); }
+
+    InplaceFunction &operator=(InplaceFunction &&other) noexcept {
+        if (this != &other) {
+            this->reset();
+            this->take(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction &) = delete;
+    InplaceFunction &operator=(const InplaceFunction &) = delete;
+
+    ~InplaceFunction() { this->reset(); }
+
+    explicit operator bool() const noexcept { return this->ops != nullptr; }
+
+    R operator()(Args... args) {
+        LN_ASSERT_PANIC(this->ops);
+        return this->ops->invoke(this->storage, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Destroy the stored callable, leaving this empty.
+     */
+    void reset() noexcept {
+        if (this->ops) {
+            this->ops->destroy(this->storage);
+            this->ops = nullptr;
+        }
+    }
+
+private:
+    struct Ops {
+        R (*invoke)(void *callable, Args &&...args);
+        void (*move)(void *to, void *from) noexcept;
+        void (*destroy)(void *callable) noexcept;
+    };
+
+    template <typename Callable>
+    static constexpr Ops ops_for{
+        [](void *callable, Args &&...args) -> R {
+            return std::invoke(*static_cast<Callable *>(callable), std::forward<Args>(args)...);
+        },
+        [](void *to, void *from) noexcept {
+            std::construct_at(static_cast<Callable *>(to), std::move(*static_cast<Callable *>(from)));
+            std::destroy_at(static_cast<Callable *>(from));
+        },
+        [](void *callable) noexcept { std::destroy_at(static_cast<Callable *>(callable)); },
+    };
+
+    void take(InplaceFunction &other) noexcept {
+        if (other.ops) {
+            other.ops->move(this->storage, other.storage);
+            this->ops = std::exchange(other.ops, nullptr);
+        }
+    }
+
+    alignas(std::max_align_t) std::byte storage[capacity];
+    const Ops *ops = nullptr;
+};
+
+} // namespace ln
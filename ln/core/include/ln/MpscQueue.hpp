@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/StaticForwardList.hpp"
+#include "ln/cache.hpp"
+
+#include <atomic>
+
+namespace ln {
+
+/**
+ * @brief Intrusive lock-free multi-producer/single-consumer queue (Vyukov).
+ *
+ * Elements derive from StaticForwardListNode<T> and are linked through its
+ * next pointer, so queueing never allocates. Any number of tasks and ISRs may
+ * push() concurrently: a push is a single atomic exchange on the head followed
+ * by one store, with no loop, critical section or disabled interrupts. Exactly
+ * one context may pop().
+ *
+ * Between its exchange and its store, a push is not yet visible to the
+ * consumer, nor is anything pushed after it. pop() then returns nullptr even
+ * though the queue is not empty; the elements show up once the interrupted
+ * producer resumes. Producers should therefore signal the consumer after every
+ * push (e.g. with a task notification) rather than only on the first one.
+ *
+ * @note A node must not be pushed again, or linked into a StaticForwardList,
+ * until it has been popped.
+ */
+template <typename T> class MpscQueue {
+public:
+    using Node = StaticForwardListNode<T>;
+
+    MpscQueue() noexcept = default;
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    /**
+     * @brief Append node to the queue. Safe from any context.
+     */
+    void push(Node &node) noexcept {
+        std::atomic_ref<Node *>{node.next}.store(nullptr, std::memory_order_relaxed);
+        Node *previous = this->head.exchange(&node, std::memory_order_acq_rel);
+        // the queue is disconnected at previous until this store lands
+        std::atomic_ref<Node *>{previous->next}.store(&node, std::memory_order_release);
+    }
+
+    /**
+     * @brief Take the oldest element. Consumer only.
+     *
+     * @return The element, or nullptr if the queue is empty or the next
+     * element's push is still in progress.
+     */
+    [[nodiscard]] T *pop() noexcept {
+        Node *first = this->tail;
+        Node *next = load_next(*first);
+        if (first == &this->stub) {
+            if (!next) {
+                return nullptr;
+            }
+            this->tail = next;
+            first = next;
+            next = load_next(*first);
+        }
+        if (next) {
+            this->tail = next;
+            return static_cast<T *>(first);
+        }
+        if (first != this->head.load(std::memory_order_acquire)) {
+            return nullptr; // a producer is between its exchange and its store
+        }
+        // first is the last element, put the stub behind it so it can be unlinked
+        this->push(this->stub);
+        next = load_next(*first);
+        if (next) {
+            this->tail = next;
+            return static_cast<T *>(first);
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Returns true if no element is ready to be popped. Exact only when
+     * called from the consumer with no push in progress.
+     */
+    [[nodiscard]] bool empty() const noexcept { return this->tail == &this->stub && !load_next(this->stub); }
+
+private:
+    static_assert(std::atomic<Node *>::is_always_lock_free, "MpscQueue requires lock-free pointer atomics");
+
+    static Node *load_next(const Node &node) noexcept {
+        return std::atomic_ref<Node *>{const_cast<Node *&>(node.next)}.load(std::memory_order_acquire);
+    }
+
+    Node stub{};
+    alignas(cache_line_size) std::atomic<Node *> head{&this->stub};
+    alignas(cache_line_size) Node *tail{&this->stub};
+};
+
+} // namespace ln
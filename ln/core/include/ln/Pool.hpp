@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/ln.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+
+namespace ln {
+
+/**
+ * @brief Fixed-size block allocator over externally provided storage.
+ *
+ * Free blocks form a singly linked list threaded through the blocks
+ * themselves, so there is no per-block overhead. allocate() and deallocate()
+ * are O(1) and lock-free (a compare-and-swap on the list head tagged against
+ * ABA), which makes them safe to call from any task or ISR concurrently.
+ *
+ * Usage counters (current, peak, failed allocations) are kept with relaxed
+ * atomics and can be read at any time with get_usage().
+ *
+ * @note Up to max_block_count blocks; each block is at least 4 bytes.
+ */
+class BlockPool {
+public:
+    static constexpr size_t max_block_count = std::numeric_limits<std::uint16_t>::max();
+
+    /**
+     * @brief Returns the distance between blocks for the given block size and
+     * alignment.
+     */
+    static constexpr size_t get_stride(size_t block_size, size_t alignment) noexcept {
+        alignment = std::max(alignment, alignof(Link));
+        return (std::max(block_size, sizeof(Link)) + alignment - 1) / alignment * alignment;
+    }
+
+    /**
+     * @brief Construct a pool of as many blocks of block_size bytes as fit
+     * into backing_storage, which must be aligned to alignment.
+     */
+    BlockPool(std::span<std::byte> backing_storage, size_t block_size,
+              size_t alignment = alignof(std::max_align_t)) noexcept
+        : storage(backing_storage), stride(get_stride(block_size, alignment)), block_size(block_size),
+          block_count(backing_storage.size() / this->stride) {
+        LN_ASSERT_PANIC(reinterpret_cast<std::uintptr_t>(backing_storage.data()) % std::max(alignment, alignof(Link)) ==
+                        0);
+        LN_ASSERT_PANIC(this->block_count <= max_block_count);
+        for (size_t i = 0; i < this->block_count; ++i) {
+            std::construct_at(this->link_at(i), i + 1 < this->block_count ? static_cast<Link>(i + 1) : end);
+        }
+        this->head.store(this->block_count > 0 ? 0 : end, std::memory_order_relaxed);
+    }
+
+    BlockPool(const BlockPool &) = delete;
+    BlockPool &operator=(const BlockPool &) = delete;
+
+    /**
+     * @brief Take a free block. Safe from any context.
+     *
+     * @return Pointer to an uninitialized block, or nullptr if the pool is
+     * exhausted.
+     */
+    [[nodiscard]] void *allocate() noexcept {
+        Link observed = this->head.load(std::memory_order_acquire);
+        while (true) {
+            const Link index = observed & index_mask;
+            if (index == end) {
+                this->failed.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            // may read a block another context has just taken; the tag then
+            // makes the compare-and-swap fail
+            const Link next = std::atomic_ref<Link>{*this->link_at(index)}.load(std::memory_order_relaxed);
+            if (this->head.compare_exchange_weak(observed, next_tag(observed) | next, std::memory_order_acquire,
+                                                 std::memory_order_acquire)) {
+                this->record_allocation();
+                return this->link_at(index);
+            }
+        }
+    }
+
+    /**
+     * @brief Return a block obtained from allocate(). Safe from any context.
+     * nullptr is ignored.
+     */
+    void deallocate(void *block) noexcept {
+        if (!block) {
+            return;
+        }
+        LN_ASSERT_PANIC(this->owns(block));
+        const auto index = static_cast<Link>((static_cast<std::byte *>(block) - this->storage.data()) / this->stride);
+        Link *link = std::construct_at(static_cast<Link *>(block), end);
+        Link observed = this->head.load(std::memory_order_relaxed);
+        do {
+            std::atomic_ref<Link>{*link}.store(observed & index_mask, std::memory_order_relaxed);
+        } while (!this->head.compare_exchange_weak(observed, next_tag(observed) | index, std::memory_order_release,
+                                                   std::memory_order_relaxed));
+        this->used.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns true if pointer is the start of a block of this pool.
+     */
+    [[nodiscard]] bool owns(const void *pointer) const noexcept {
+        const auto *byte = static_cast<const std::byte *>(pointer);
+        const std::byte *begin = this->storage.data();
+        return byte >= begin && byte < begin + this->block_count * this->stride &&
+               static_cast<size_t>(byte - begin) % this->stride == 0;
+    }
+
+    /**
+     * @brief Returns the usable size of each block in bytes.
+     */
+    [[nodiscard]] size_t get_block_size() const noexcept { return this->block_size; }
+
+    /**
+     * @brief Returns the total number of blocks.
+     */
+    [[nodiscard]] size_t get_block_count() const noexcept { return this->block_count; }
+
+    struct Usage {
+        size_t used;   ///< blocks currently allocated
+        size_t peak;   ///< high-water mark of used
+        size_t failed; ///< allocate() calls that found the pool exhausted
+        size_t total;  ///< block count
+    };
+
+    /**
+     * @brief Snapshot of the usage counters.
+     */
+    [[nodiscard]] Usage get_usage() const noexcept {
+        return {this->used.load(std::memory_order_relaxed), this->peak.load(std::memory_order_relaxed),
+                this->failed.load(std::memory_order_relaxed), this->block_count};
+    }
+
+private:
+    using Link = std::uint32_t; // high half: ABA tag, low half: block index
+    static_assert(std::atomic<Link>::is_always_lock_free, "BlockPool requires lock-free 32-bit atomics");
+
+    static constexpr Link index_mask = 0xFFFF;
+    static constexpr Link end = index_mask;
+
+    static constexpr Link next_tag(Link head) noexcept { return (head & ~index_mask) + (index_mask + 1); }
+
+    Link *link_at(size_t index) noexcept { return reinterpret_cast<Link *>(&this->storage[index * this->stride]); }
+
+    void record_allocation() noexcept {
+        const size_t now_used = this->used.fetch_add(1, std::memory_order_relaxed) + 1;
+        size_t observed_peak = this->peak.load(std::memory_order_relaxed);
+        while (now_used > observed_peak &&
+               !this->peak.compare_exchange_weak(observed_peak, now_used, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::span<std::byte> storage;
+    size_t stride;
+    size_t block_size;
+    size_t block_count;
+    std::atomic<Link> head{end};
+    std::atomic<size_t> used{0};
+    std::atomic<size_t> peak{0};
+    std::atomic<size_t> failed{0};
+};
+
+/**
+ * @brief Owning pool of N blocks sized and aligned for T, with typed
+ * create()/destroy().
+ */
+template <typename T, size_t N> class Pool : public BlockPool {
+    static_assert(N > 0 && N <= BlockPool::max_block_count, "Pool capacity N out of range");
+
+public:
+    Pool() noexcept : BlockPool{buffer, sizeof(T), alignof(T)} {}
+
+    /**
+     * @brief Allocate a block and construct T in it. Safe from any context if
+     * T's constructor is.
+     *
+     * @return The new object, or nullptr if the pool is exhausted.
+     */
+    template <typename... Args> [[nodiscard]] T *create(Args &&...args) noexcept {
+        void *block = this->allocate();
+        if (!block) {
+            return nullptr;
+        }
+        return std::construct_at(static_cast<T *>(block), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Destroy an object obtained from create() and return its block.
+     * nullptr is ignored.
+     */
+    void destroy(T *object) noexcept {
+        if (!object) {
+            return;
+        }
+        std::destroy_at(object);
+        this->deallocate(object);
+    }
+
+private:
+    static constexpr size_t alignment = std::max(alignof(T), alignof(std::uint32_t));
+    alignas(alignment) std::array<std::byte, BlockPool::get_stride(sizeof(T), alignof(T)) * N> buffer;
+};
+
+/**
+ * @brief Standard allocator adapter over a BlockPool for node-based containers
+ * (std::list, std::map, std::set, ...) that allocate one element at a time.
+ *
+ * Requests for more than one element, or for elements larger than a block,
+ * panic, as does pool exhaustion, since standard containers cannot handle a
+ * null allocation without exceptions.
+ */
+template <typename T> class PoolAllocator {
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(BlockPool &pool) noexcept : pool(&pool) {}
+    template <typename U> PoolAllocator(const PoolAllocator<U> &other) noexcept : pool(other.pool) {}
+
+    [[nodiscard]] T *allocate(size_t n) noexcept {
+        LN_ASSERT_PANIC(n == 1 && sizeof(T) <= this->pool->get_block_size());
+        void *block = this->pool->allocate();
+        LN_ASSERT_PANIC(block);
+        return static_cast<T *>(block);
+    }
+
+    void deallocate(T *pointer, size_t /*n*/) noexcept { this->pool->deallocate(pointer); }
+
+    template <typename U> bool operator==(const PoolAllocator<U> &other) const noexcept {
+        return this->pool == other.pool;
+    }
+
+private:
+    template <typename U> friend class PoolAllocator;
+
+    BlockPool *pool;
+};
+
+} // namespace ln
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/cache.hpp"
+#include "ln/ln.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+
+namespace ln {
+
+/**
+ * @brief Queue of variable-length records in externally provided byte
+ * storage.
+ *
+ * Each record is a header followed by its payload, padded to
+ * record_alignment. A record never straddles the end of storage: if it does
+ * not fit before the end, the remainder is filled with a skip marker that the
+ * consumer silently drops. Producers reserve() a contiguous payload region,
+ * fill it and commit() it; the consumer reads front() in place and pop()s it.
+ *
+ * The header doubles as the commit flag, so the consumer never reads the
+ * producer index. Released space is zeroed by the consumer, which is what
+ * makes a not-yet-committed header distinguishable from stale data.
+ *
+ * In ProducerMode::multi, reserve() claims space with a compare-and-swap, so
+ * any number of tasks and ISRs may produce concurrently without a critical
+ * section. Records are consumed in reservation order, so a reserved but
+ * uncommitted record holds back the ones behind it.
+ *
+ * @note Capacity must be a power of two and storage aligned to
+ * record_alignment.
+ */
+class RecordRingView {
+public:
+    enum class ProducerMode {
+        single, ///< one producer context, plain index update
+        multi   ///< any number of producer contexts, compare-and-swap reservation
+    };
+
+    static constexpr size_t record_alignment = 8;
+
+    /**
+     * @brief Construct a record ring over the given byte span. The storage is
+     * zeroed.
+     */
+    explicit RecordRingView(std::span<std::byte> backing_storage, ProducerMode mode = ProducerMode::single) noexcept
+        : storage(backing_storage), mode(mode) {
+        LN_ASSERT_PANIC(std::has_single_bit(backing_storage.size()) && backing_storage.size() >= sizeof(Header));
+        LN_ASSERT_PANIC(reinterpret_cast<std::uintptr_t>(backing_storage.data()) % record_alignment == 0);
+        std::memset(this->storage.data(), 0, this->storage.size());
+    }
+
+    RecordRingView(const RecordRingView &) = delete;
+    RecordRingView &operator=(const RecordRingView &) = delete;
+
+    /**
+     * @brief Returns the capacity in bytes, including headers and padding.
+     */
+    [[nodiscard]] size_t capacity() const noexcept { return this->storage.size(); }
+
+    /**
+     * @brief Returns the number of reserved or committed bytes, including
+     * headers and padding.
+     */
+    [[nodiscard]] size_t get_used_space() const noexcept {
+        return this->tail.load(std::memory_order_acquire) - this->head.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns the largest payload size a reserve() could ever succeed
+     * with.
+     */
+    [[nodiscard]] size_t max_record_size() const noexcept { return this->capacity() - sizeof(Header); }
+
+    /**
+     * @brief Reserve a contiguous payload region of size bytes. Producer side.
+     *
+     * @return The payload region to fill and then pass to commit(), or an empty
+     * span if there is not enough free space.
+     */
+    [[nodiscard]] std::span<std::byte> reserve(size_t size) noexcept {
+        if (size > this->max_record_size()) {
+            return {};
+        }
+        const size_t record_size = align_up(sizeof(Header) + size);
+        size_t tail = this->tail.load(std::memory_order_relaxed);
+        size_t skip_size = 0;
+        while (true) {
+            const size_t head = this->head.load(std::memory_order_acquire);
+            const size_t to_end = this->capacity() - this->wrap(tail);
+            skip_size = record_size > to_end ? to_end : 0;
+            if (skip_size + record_size > this->capacity() - (tail - head)) {
+                return {};
+            }
+            if (this->mode == ProducerMode::single) {
+                this->tail.store(tail + skip_size + record_size, std::memory_order_relaxed);
+                break;
+            }
+            if (this->tail.compare_exchange_weak(tail, tail + skip_size + record_size, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        if (skip_size > 0) {
+            Header &skip = this->header_at(this->wrap(tail));
+            skip.span_size = static_cast<std::uint32_t>(skip_size);
+            std::atomic_ref<std::uint32_t>{skip.state}.store(Header::committed | Header::skip,
+                                                             std::memory_order_release);
+        }
+        const size_t position = this->wrap(tail + skip_size);
+        this->header_at(position).span_size = static_cast<std::uint32_t>(record_size);
+        return this->storage.subspan(position + sizeof(Header), size);
+    }
+
+    /**
+     * @brief Publish a reserved record to the consumer. Producer side.
+     *
+     * @param record Region returned by reserve() or its prefix, which commits
+     * a shorter record.
+     * @return false if record is longer than the reservation.
+     */
+    bool commit(std::span<const std::byte> record) noexcept {
+        Header &header = *reinterpret_cast<Header *>(const_cast<std::byte *>(record.data()) - sizeof(Header));
+        if (sizeof(Header) + record.size() > header.span_size) {
+            return false;
+        }
+        const auto state = Header::committed | static_cast<std::uint32_t>(record.size());
+        std::atomic_ref<std::uint32_t>{header.state}.store(state, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Oldest record, read in place. Consumer side.
+     *
+     * @return The record payload, or std::nullopt if there is no committed
+     * record at the front.
+     */
+    [[nodiscard]] std::optional<std::span<const std::byte>> front() noexcept {
+        const Header *header = this->front_header();
+        if (!header) {
+            return std::nullopt;
+        }
+        return std::span<const std::byte>{reinterpret_cast<const std::byte *>(header + 1),
+                                          header->state & Header::size_mask};
+    }
+
+    /**
+     * @brief Release the oldest record. Consumer side.
+     *
+     * @return false if there is no committed record at the front.
+     */
+    bool pop() noexcept {
+        const Header *header = this->front_header();
+        if (!header) {
+            return false;
+        }
+        this->release(header->span_size);
+        return true;
+    }
+
+    /**
+     * @brief Copy the oldest record into out and release it. Consumer side.
+     *
+     * @return Record size, or std::nullopt if there is no committed record at
+     * the front or it does not fit into out, in which case it is kept.
+     */
+    [[nodiscard]] std::optional<size_t> pop(std::span<std::byte> out) noexcept {
+        const auto record = this->front();
+        if (!record || record->size() > out.size()) {
+            return std::nullopt;
+        }
+        std::copy_n(record->data(), record->size(), out.data());
+        this->pop();
+        return record->size();
+    }
+
+private:
+    struct Header {
+        static constexpr std::uint32_t committed = 1U << 31;
+        static constexpr std::uint32_t skip = 1U << 30;
+        static constexpr std::uint32_t size_mask = skip - 1;
+
+        std::uint32_t state;     // zero until committed, then flags and payload size
+        std::uint32_t span_size; // header, payload and padding in bytes
+    };
+    static_assert(sizeof(Header) == record_alignment);
+
+    static constexpr size_t align_up(size_t size) noexcept {
+        return (size + record_alignment - 1) & ~(record_alignment - 1);
+    }
+
+    [[nodiscard]] size_t wrap(size_t index) const noexcept { return index & (this->capacity() - 1); }
+
+    Header &header_at(size_t position) noexcept { return *reinterpret_cast<Header *>(&this->storage[position]); }
+
+    /**
+     * @brief Header of the oldest committed record, dropping skip markers on
+     * the way.
+     */
+    const Header *front_header() noexcept {
+        while (true) {
+            Header &header = this->header_at(this->wrap(this->head.load(std::memory_order_relaxed)));
+            const std::uint32_t state = std::atomic_ref<std::uint32_t>{header.state}.load(std::memory_order_acquire);
+            if (!(state & Header::committed)) {
+                return nullptr;
+            }
+            if (!(state & Header::skip)) {
+                return &header;
+            }
+            this->release(header.span_size);
+        }
+    }
+
+    void release(size_t span_size) noexcept {
+        const size_t head = this->head.load(std::memory_order_relaxed);
+        std::memset(&this->storage[this->wrap(head)], 0, span_size);
+        this->head.store(head + span_size, std::memory_order_release);
+    }
+
+    std::span<std::byte> storage;
+    ProducerMode mode;
+    alignas(cache_line_size) std::atomic<size_t> head{0}; // oldest record, written by consumer
+    alignas(cache_line_size) std::atomic<size_t> tail{0}; // end of reserved space, written by producers
+};
+
+/**
+ * @brief Owning fixed-size record ring with internal static storage.
+ */
+template <size_t N> class RecordRing : public RecordRingView {
+    static_assert(std::has_single_bit(N) && N >= RecordRingView::record_alignment,
+                  "RecordRing capacity N must be a power of two");
+
+public:
+    using Base = RecordRingView;
+    explicit RecordRing(ProducerMode mode = ProducerMode::single) noexcept : Base{buffer, mode} {}
+
+private:
+    alignas(RecordRingView::record_alignment) std::array<std::byte, N> buffer;
+};
+
+} // namespace ln
@@ -9,26 +9,118 @@
 
 #pragma once
 
+#include "ln/ln.h"
+
+#include <bit>
 #include <cstddef>
 #include <span>
 #include <array>
 #include <type_traits>
 #include <optional>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
 #include <ranges>
+#include <utility>
 
 namespace ln {
 
 /**
- * @brief Ring buffer (circular buffer) interface/manager for externally
- * provided storage.
+ * @brief Element lifetime handling of StaticRingBuffer.
+ */
+enum class RingBufferElements {
+    trivial,    ///< trivially destructible T, slots always hold live objects
+    non_trivial ///< any nothrow movable T, constructed on insertion and destroyed on removal
+};
+
+namespace detail {
+
+/**
+ * @brief RingBufferView storage: externally provided span, run-time capacity.
+ */
+template <typename T, bool is_power_of_two> struct SpanRingStorage {
+    using index_type = size_t;
+    static constexpr bool power_of_two = is_power_of_two;
+    static constexpr bool manages_lifetime = false;
+
+    [[nodiscard]] size_t capacity() const noexcept { return this->elements.size(); }
+    [[nodiscard]] std::span<T> slots() noexcept { return this->elements; }
+    [[nodiscard]] std::span<const T> slots() const noexcept { return this->elements; }
+
+    std::span<T> elements;
+};
+
+/**
+ * @brief Smallest unsigned type that can hold N.
+ */
+template <size_t N>
+using ring_index_t =
+    std::conditional_t<N <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+                       std::conditional_t<N <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t, size_t>>;
+
+/**
+ * @brief StaticRingBuffer storage: inline array, compile-time capacity and the
+ * smallest index type that can hold N.
  */
+template <typename T, size_t N> struct ArrayRingStorage {
+    using index_type = ring_index_t<N>;
+    static constexpr bool power_of_two = std::has_single_bit(N);
+    static constexpr bool manages_lifetime = false;
 
-template <typename T> class RingBufferView {
-    static_assert(std::is_trivially_destructible<T>::value,
-                  "RingBufferView requires trivially destructible T for embedded safety");
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return N; }
+    [[nodiscard]] std::span<T> slots() noexcept { return this->elements; }
+    [[nodiscard]] std::span<const T> slots() const noexcept { return this->elements; }
+
+    std::array<T, N> elements;
+};
+
+/**
+ * @brief StaticRingBuffer storage for RingBufferElements::non_trivial: raw
+ * inline memory in which elements are constructed on push and destroyed on
+ * removal.
+ */
+template <typename T, size_t N> struct ObjectRingStorage {
+    static_assert(std::is_nothrow_move_constructible_v<T>, "RingBuffer requires nothrow move constructible T");
+
+    using index_type = ring_index_t<N>;
+    static constexpr bool power_of_two = std::has_single_bit(N);
+    static constexpr bool manages_lifetime = true;
+
+    ObjectRingStorage() noexcept = default;
+    ObjectRingStorage(const ObjectRingStorage &) = delete;
+    ObjectRingStorage &operator=(const ObjectRingStorage &) = delete;
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return N; }
+    [[nodiscard]] std::span<T> slots() noexcept { return {reinterpret_cast<T *>(this->bytes), N}; }
+    [[nodiscard]] std::span<const T> slots() const noexcept { return {reinterpret_cast<const T *>(this->bytes), N}; }
+
+    alignas(T) std::byte bytes[N * sizeof(T)];
+};
+
+} // namespace detail
+
+/**
+ * @brief Ring buffer (circular buffer) implementation shared by RingBufferView
+ * and StaticRingBuffer, which differ only in how storage, capacity and indices
+ * are held.
+ *
+ * In power of two mode head and tail run freely and are wrapped by masking,
+ * so no element count is kept and no division is performed on element access.
+ * Free-running indices wrap together with index_type, which stays correct
+ * because the capacity is a power of two not larger than the index range.
+ */
+template <typename T, typename Storage> class BasicRingBuffer {
+    static_assert(Storage::manages_lifetime || std::is_trivially_destructible<T>::value,
+                  "RingBuffer requires trivially destructible T for embedded safety, "
+                  "or opt-in RingBufferElements::non_trivial");
 
 public:
+    static constexpr bool power_of_two = Storage::power_of_two;
+    static constexpr bool manages_lifetime = Storage::manages_lifetime;
+    using index_type = typename Storage::index_type;
+
     template <bool is_const> struct _iterator {
         using iterator_category = std::random_access_iterator_tag;
         using value_type = T;
@@ -36,7 +128,7 @@ public:
         using pointer = std::conditional_t<is_const, const T *, T *>;
         using reference = std::conditional_t<is_const, const T &, T &>;
 
-        std::conditional_t<is_const, const RingBufferView *, RingBufferView *> parent;
+        std::conditional_t<is_const, const BasicRingBuffer *, BasicRingBuffer *> parent;
         size_t index; // logical position from head
 
         reference operator*() const { return (*parent)[index]; }
@@ -95,46 +187,48 @@ public:
     [[nodiscard]] auto begin() const noexcept { return const_iterator{this, 0}; }
     [[nodiscard]] auto end() const noexcept { return const_iterator{this, this->size()}; }
 
-    /**
-     * @brief Construct a ring buffer over the given span.
-     *
-     * The size of the span defines the capacity of the ring buffer.
-     */
-    explicit RingBufferView(std::span<T> backing_storage) noexcept
-        : storage(backing_storage), head(0), tail(0), count(0) {}
-
     /**
      * @brief Returns the number of elements stored in the buffer.
      */
-    [[nodiscard]] size_t size() const noexcept { return this->count; }
+    [[nodiscard]] size_t size() const noexcept {
+        if constexpr (power_of_two) {
+            return static_cast<index_type>(this->tail - this->head);
+        }
+        else {
+            return this->count;
+        }
+    }
 
     /**
      * @brief Returns the capacity of the buffer.
      */
-    [[nodiscard]] size_t capacity() const noexcept { return this->storage.size(); }
+    [[nodiscard]] constexpr size_t capacity() const noexcept { return this->storage.capacity(); }
 
     /**
      * @brief Returns true if no elements are stored.
      */
-    [[nodiscard]] bool empty() const noexcept { return this->count == 0; }
+    [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
 
     /**
      * @brief Returns true if the buffer cannot accept more elements.
      */
-    [[nodiscard]] bool full() const noexcept { return this->count == this->storage.size(); }
+    [[nodiscard]] bool full() const noexcept { return this->size() == this->capacity(); }
 
     /**
      * @brief Returns how many elements can still be inserted.
      */
-    [[nodiscard]] size_t get_free_space() const noexcept { return this->capacity() - this->count; }
+    [[nodiscard]] size_t get_free_space() const noexcept { return this->capacity() - this->size(); }
 
     /**
      * @brief Remove all elements from the buffer.
      */
     void clear() noexcept {
+        this->destroy_front(this->size());
         this->head = 0;
         this->tail = 0;
-        this->count = 0;
+        if constexpr (!power_of_two) {
+            this->count = 0;
+        }
     }
 
     enum class PushMode {
@@ -147,46 +241,62 @@ public:
      *
      * @return false if the buffer is already full.
      */
-    bool push(const T &value, PushMode mode = PushMode::normal) noexcept {
-        if (this->full()) {
-            if (mode == PushMode::normal) {
-                return false;
-            }
-            this->advance_head(1);
-        }
-        this->storage[this->tail] = value;
-        this->advance_tail(1);
-        return true;
-    }
+    bool push(const T &value, PushMode mode = PushMode::normal) noexcept { return this->emplace_with(mode, value); }
 
     bool push_overwrite(const T &value) noexcept { return this->push(value, PushMode::overwrite); }
 
-    bool push(const std::span<const T> &values, PushMode mode = PushMode::normal) noexcept {
-        size_t to_push = values.size();
-        if (to_push == 0) {
+    /**
+     * @brief Try to move an element to the back of the buffer.
+     *
+     * @return false if the buffer is already full.
+     */
+    bool push(T &&value, PushMode mode = PushMode::normal) noexcept {
+        return this->emplace_with(mode, std::move(value));
+    }
+
+    bool push_overwrite(T &&value) noexcept { return this->push(std::move(value), PushMode::overwrite); }
+
+    /**
+     * @brief Try to construct an element in place at the back of the buffer.
+     *
+     * @return false if the buffer is already full.
+     */
+    template <typename... Args> bool emplace(Args &&...args) noexcept {
+        return this->emplace_with(PushMode::normal, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args> bool emplace_overwrite(Args &&...args) noexcept {
+        return this->emplace_with(PushMode::overwrite, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Try to push all elements to the back of the buffer. In overwrite
+     * mode, values longer than the capacity leave only their last capacity()
+     * elements.
+     *
+     * @return false in normal mode if there is not enough free space, in
+     * which case nothing is pushed.
+     */
+    bool push(std::span<const T> values, PushMode mode = PushMode::normal) noexcept {
+        if (values.empty()) {
             return true;
         }
-        size_t free_space = this->get_free_space();
-        if (to_push > free_space) {
+        const size_t free_space = this->get_free_space();
+        if (values.size() > free_space) {
             if (mode == PushMode::normal) {
                 return false;
             }
-            size_t overwrite_count = to_push - free_space;
-            this->advance_head(overwrite_count);
-            to_push = free_space + overwrite_count;
+            values = values.last(std::min(values.size(), this->capacity()));
+            this->drop_front(values.size() - std::min(values.size(), free_space));
         }
 
-        size_t first_chunk_size = this->get_contiguous_push_space(mode);
-        if (first_chunk_size >= to_push) {
-            std::copy_n(values.data(), to_push, &this->storage[this->tail]);
-            this->advance_tail(to_push);
-        }
-        else {
-            std::copy_n(values.data(), first_chunk_size, &this->storage[this->tail]);
-            size_t second_chunk_size = to_push - first_chunk_size;
-            std::copy_n(values.data() + first_chunk_size, second_chunk_size, &this->storage[0]);
-            this->advance_tail(to_push);
-        }
+        const size_t to_push = values.size();
+        const size_t first_chunk_size = std::min(to_push, this->capacity() - this->position(this->tail));
+        // trivially destructible slots may be reconstructed in place, so both
+        // element modes share this path
+        std::uninitialized_copy_n(values.data(), first_chunk_size, &this->slots()[this->position(this->tail)]);
+        std::uninitialized_copy_n(values.data() + first_chunk_size, to_push - first_chunk_size, this->slots().data());
+        this->advance_tail(to_push);
         return true;
     }
 
@@ -201,11 +311,170 @@ public:
         if (this->empty()) {
             return std::nullopt;
         }
-        T value = this->storage[this->head];
-        this->advance_head(1);
+        std::optional<T> value{std::move(this->front_slot())};
+        this->drop_front(1);
         return value;
     }
 
+    /**
+     * @brief Move the oldest element into out and remove it. Avoids the
+     * std::optional temporary of pop() for large elements.
+     *
+     * @return false if the buffer is empty, in which case out is untouched.
+     */
+    bool pop_into(T &out) noexcept {
+        if (this->empty()) {
+            return false;
+        }
+        out = std::move(this->front_slot());
+        this->drop_front(1);
+        return true;
+    }
+
+    /**
+     * @brief Move up to values.size() oldest elements into values and remove
+     * them.
+     *
+     * @return Number of elements popped.
+     */
+    [[nodiscard]] size_t pop(std::span<T> values) noexcept {
+        const auto [first_chunk, second_chunk] = this->split(this->slots(), 0, std::min(values.size(), this->size()));
+        std::move(first_chunk.begin(), first_chunk.end(), values.begin());
+        std::move(second_chunk.begin(), second_chunk.end(), values.begin() + first_chunk.size());
+        const size_t popped = first_chunk.size() + second_chunk.size();
+        this->drop_front(popped);
+        return popped;
+    }
+
+    /**
+     * @brief Copy up to values.size() elements starting at the given logical
+     * index into values without removing them.
+     *
+     * @return Number of elements copied.
+     */
+    [[nodiscard]] size_t peek(std::span<T> values, size_t offset = 0) const noexcept {
+        const auto [first_chunk, second_chunk] = this->chunks(offset, values.size());
+        std::copy_n(first_chunk.data(), first_chunk.size(), values.data());
+        std::copy_n(second_chunk.data(), second_chunk.size(), values.data() + first_chunk.size());
+        return first_chunk.size() + second_chunk.size();
+    }
+
+    /**
+     * @brief Remove up to count oldest elements without reading them.
+     *
+     * @return Number of elements removed.
+     */
+    size_t discard(size_t count) noexcept {
+        count = std::min(count, this->size());
+        this->drop_front(count);
+        return count;
+    }
+
+    /**
+     * @brief Largest contiguous free region at the back of the buffer. Fill it
+     * directly (e.g. by DMA) and publish the written elements with commit().
+     */
+    [[nodiscard]] std::span<T> writable_span() noexcept
+        requires(!manages_lifetime)
+    {
+        return this->slots().subspan(this->position(this->tail), this->get_contiguous_push_space(PushMode::normal));
+    }
+
+    /**
+     * @brief Append count elements previously written into writable_span().
+     *
+     * @return false if count exceeds the writable_span() size.
+     */
+    bool commit(size_t count) noexcept
+        requires(!manages_lifetime)
+    {
+        if (count > this->get_contiguous_push_space(PushMode::normal)) {
+            return false;
+        }
+        this->advance_tail(count);
+        return true;
+    }
+
+    /**
+     * @brief Stored elements in FIFO order as up to two contiguous regions. The
+     * second span is empty unless the data wraps around the end of storage.
+     * Release the processed elements with consume().
+     */
+    [[nodiscard]] std::array<std::span<T>, 2> readable_spans() noexcept {
+        return this->split(this->slots(), 0, this->size());
+    }
+
+    [[nodiscard]] std::array<std::span<const T>, 2> readable_spans() const noexcept { return this->chunks(); }
+
+    /**
+     * @brief Remove count oldest elements after reading them via
+     * readable_spans().
+     *
+     * @return false if fewer than count elements are stored.
+     */
+    bool consume(size_t count) noexcept {
+        if (count > this->size()) {
+            return false;
+        }
+        this->drop_front(count);
+        return true;
+    }
+
+    /**
+     * @brief Elements [offset, offset + count) in FIFO order as up to two
+     * contiguous regions. The range is clamped to the stored elements. The
+     * second span is empty unless the range wraps around the end of storage.
+     */
+    [[nodiscard]] std::array<std::span<const T>, 2> chunks(size_t offset = 0, size_t count = npos) const noexcept {
+        offset = std::min(offset, this->size());
+        return this->split(this->slots(), offset, std::min(count, this->size() - offset));
+    }
+
+    /**
+     * @brief Logical index of the first element equal to value within
+     * [first, last), searched chunk by chunk. Byte-sized integral and enum
+     * element types use memchr().
+     *
+     * @return Index of the match, or min(last, size()) if there is none.
+     */
+    [[nodiscard]] size_t find(const T &value, size_t first = 0, size_t last = npos) const noexcept {
+        last = std::min(last, this->size());
+        if (first >= last) {
+            return last;
+        }
+        const auto [first_chunk, second_chunk] = this->chunks(first, last - first);
+        if (const T *match = find_in(first_chunk, value)) {
+            return first + static_cast<size_t>(match - first_chunk.data());
+        }
+        if (const T *match = find_in(second_chunk, value)) {
+            return first + first_chunk.size() + static_cast<size_t>(match - second_chunk.data());
+        }
+        return last;
+    }
+
+    /**
+     * @brief Logical index of the last element equal to value within
+     * [first, last), searched chunk by chunk.
+     *
+     * @return Index of the match, or min(last, size()) if there is none.
+     */
+    [[nodiscard]] size_t rfind(const T &value, size_t first = 0, size_t last = npos) const noexcept {
+        last = std::min(last, this->size());
+        if (first >= last) {
+            return last;
+        }
+        const auto [first_chunk, second_chunk] = this->chunks(first, last - first);
+        if (const T *match = rfind_in(second_chunk, value)) {
+            return first + first_chunk.size() + static_cast<size_t>(match - second_chunk.data());
+        }
+        if (const T *match = rfind_in(first_chunk, value)) {
+            return first + static_cast<size_t>(match - first_chunk.data());
+        }
+        return last;
+    }
+
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
     /**
      * @brief Random access operator (read/write) by logical index.
      *
@@ -213,8 +482,7 @@ public:
      * to the newest element. Behaviour is undefined if index >= size().
      */
     [[nodiscard]] T &operator[](size_t index) noexcept {
-        size_t physical = (this->head + index) % this->storage.size();
-        return this->storage[physical];
+        return this->slots()[this->wrap(this->head + index)];
     }
 
     /**
@@ -224,50 +492,222 @@ public:
      * to the newest element. Behaviour is undefined if index >= size().
      */
     [[nodiscard]] const T &operator[](size_t index) const noexcept {
-        size_t physical = (this->head + index) % this->storage.size();
-        return this->storage[physical];
+        return this->slots()[this->wrap(this->head + index)];
+    }
+
+protected:
+    BasicRingBuffer() noexcept = default;
+    explicit BasicRingBuffer(Storage storage) noexcept : storage(storage) {}
+
+    ~BasicRingBuffer()
+        requires(!manages_lifetime)
+    = default;
+    ~BasicRingBuffer()
+        requires(manages_lifetime)
+    {
+        this->clear();
     }
 
 private:
+    [[nodiscard]] std::span<T> slots() noexcept { return this->storage.slots(); }
+    [[nodiscard]] std::span<const T> slots() const noexcept { return this->storage.slots(); }
+    [[nodiscard]] T &front_slot() noexcept { return this->slots()[this->position(this->head)]; }
+
+    template <typename... Args> bool emplace_with(PushMode mode, Args &&...args) noexcept {
+        if (this->full()) {
+            if (mode == PushMode::normal) {
+                return false;
+            }
+            this->drop_front(1);
+        }
+        std::construct_at(&this->slots()[this->position(this->tail)], std::forward<Args>(args)...);
+        this->advance_tail(1);
+        return true;
+    }
+
+    /**
+     * @brief Destroy count oldest elements, if element lifetime is managed.
+     */
+    void destroy_front(size_t count) noexcept {
+        if constexpr (manages_lifetime) {
+            const auto [first_chunk, second_chunk] = this->split(this->slots(), 0, count);
+            std::destroy(first_chunk.begin(), first_chunk.end());
+            std::destroy(second_chunk.begin(), second_chunk.end());
+        }
+    }
+
+    /**
+     * @brief Remove count oldest elements.
+     */
+    void drop_front(size_t count) noexcept {
+        this->destroy_front(count);
+        this->advance_head(count);
+    }
+
+    static constexpr bool is_memchr_searchable = sizeof(T) == 1 && (std::is_integral_v<T> || std::is_enum_v<T>);
+
+    static const T *find_in(std::span<const T> chunk, const T &value) noexcept {
+        if (chunk.empty()) {
+            return nullptr;
+        }
+        if constexpr (is_memchr_searchable) {
+            return static_cast<const T *>(std::memchr(chunk.data(), static_cast<unsigned char>(value), chunk.size()));
+        }
+        else {
+            const auto it = std::find(chunk.begin(), chunk.end(), value);
+            return it == chunk.end() ? nullptr : &*it;
+        }
+    }
+
+    static const T *rfind_in(std::span<const T> chunk, const T &value) noexcept {
+        if (chunk.empty()) {
+            return nullptr;
+        }
+#if defined(__GLIBC__) && defined(_GNU_SOURCE)
+        if constexpr (is_memchr_searchable) {
+            return static_cast<const T *>(memrchr(chunk.data(), static_cast<unsigned char>(value), chunk.size()));
+        }
+#endif
+        const auto it = std::find(chunk.rbegin(), chunk.rend(), value);
+        return it == chunk.rend() ? nullptr : &*it;
+    }
+
+    /**
+     * @brief Split elements [offset, offset + count) into regions before and
+     * after the end of storage. Range must be within the stored elements.
+     */
+    template <typename U>
+    [[nodiscard]] std::array<std::span<U>, 2> split(std::span<U> all, size_t offset, size_t count) const noexcept {
+        const size_t start = this->wrap(this->head + offset);
+        const size_t first_chunk_size = std::min(count, this->capacity() - start);
+        return {all.subspan(start, first_chunk_size), all.first(count - first_chunk_size)};
+    }
+
     size_t get_contiguous_push_space(PushMode mode) const noexcept {
         if (this->full()) {
             if (mode == PushMode::normal) {
                 return 0;
             }
-            return this->capacity() - this->head;
+            return this->capacity() - this->position(this->head);
         }
-        if (this->tail >= this->head) {
-            return this->capacity() - this->tail;
+        const size_t head_position = this->position(this->head);
+        const size_t tail_position = this->position(this->tail);
+        if (tail_position >= head_position) {
+            return this->capacity() - tail_position;
         }
         if (mode == PushMode::normal) {
-            return this->head - this->tail;
+            return head_position - tail_position;
         }
-        return this->capacity() - this->tail;
+        return this->capacity() - tail_position;
     }
 
     void advance_head(size_t step) noexcept {
-        this->advance(this->head, step);
-        this->count -= step;
+        if constexpr (power_of_two) {
+            this->head = static_cast<index_type>(this->head + step);
+        }
+        else {
+            this->advance(this->head, step);
+            this->count = static_cast<index_type>(this->count - step);
+        }
     }
 
     void advance_tail(size_t step) noexcept {
-        this->advance(this->tail, step);
-        this->count += step;
+        if constexpr (power_of_two) {
+            this->tail = static_cast<index_type>(this->tail + step);
+        }
+        else {
+            this->advance(this->tail, step);
+            this->count = static_cast<index_type>(this->count + step);
+        }
     }
 
-    void advance(size_t &index, size_t step) noexcept { index = (index + step) % storage.size(); }
+    void advance(index_type &index, size_t step) noexcept {
+        index = static_cast<index_type>((index + step) % this->capacity());
+    }
 
-    std::span<T> storage;
-    size_t head; // index of oldest element
-    size_t tail; // index one past newest element
-    size_t count;
+    /**
+     * @brief Storage position of any index relative to storage begin.
+     */
+    [[nodiscard]] size_t wrap(size_t index) const noexcept {
+        if constexpr (power_of_two) {
+            return index & (this->capacity() - 1);
+        }
+        else {
+            return index % this->capacity();
+        }
+    }
+
+    /**
+     * @brief Storage position of head or tail. These are kept wrapped in
+     * modulo mode and free-running in power of two mode.
+     */
+    [[nodiscard]] size_t position(size_t head_or_tail) const noexcept {
+        if constexpr (power_of_two) {
+            return this->wrap(head_or_tail);
+        }
+        else {
+            return head_or_tail;
+        }
+    }
+
+    struct NoCount {};
+
+    Storage storage;
+    index_type head = 0; // index of oldest element
+    index_type tail = 0; // index one past newest element
+    [[no_unique_address]] std::conditional_t<power_of_two, NoCount, index_type> count{};
 };
 
+/**
+ * @brief Ring buffer interface/manager for externally provided storage.
+ *
+ * RingBufferView<T> is the common base of every RingBuffer<T, N>, so code
+ * taking a RingBufferView<T>& accepts any of them.
+ *
+ * @tparam power_of_two Opt-in mask-based indexing. Capacity must be a power of
+ * two (checked at compile time for std::array storage, at run time otherwise)
+ * or zero, in which case nothing may be pushed.
+ * A PowerOfTwoRingBufferView is a distinct type, not a RingBufferView<T>.
+ */
+template <typename T, bool power_of_two = false>
+class RingBufferView : public BasicRingBuffer<T, detail::SpanRingStorage<T, power_of_two>> {
+public:
+    using Base = BasicRingBuffer<T, detail::SpanRingStorage<T, power_of_two>>;
+
+    /**
+     * @brief Construct a ring buffer over the given span.
+     *
+     * The size of the span defines the capacity of the ring buffer.
+     */
+    explicit RingBufferView(std::span<T> backing_storage) noexcept : Base{{backing_storage}} {
+        if constexpr (power_of_two) {
+            LN_ASSERT_PANIC(backing_storage.empty() || std::has_single_bit(backing_storage.size()));
+        }
+    }
+
+    /**
+     * @brief Construct a ring buffer over the given array.
+     *
+     * Same as the span constructor, but power of two capacity is checked at
+     * compile time.
+     */
+    template <size_t N> explicit RingBufferView(std::array<T, N> &backing_storage) noexcept : Base{{backing_storage}} {
+        static_assert(!power_of_two || std::has_single_bit(N), "RingBufferView capacity must be a power of two");
+    }
+};
+
+/**
+ * @brief Ring buffer view with mask-based indexing, see RingBufferView.
+ */
+template <typename T> using PowerOfTwoRingBufferView = RingBufferView<T, true>;
+
 /**
  * @brief Owning fixed-size ring buffer with internal static storage.
  *
  * This is a convenience wrapper that owns a statically-sized array and
  * exposes the same API as RingBufferView by providing its storage span.
+ * Always modulo indexed, so it can be passed as a RingBufferView<T>; for
+ * mask-based indexing use StaticRingBuffer or a PowerOfTwoRingBufferView.
  */
 template <typename T, size_t N> class RingBuffer : public RingBufferView<T> {
     static_assert(N > 0, "RingBuffer capacity N must be > 0");
@@ -280,4 +720,34 @@ private:
     std::array<T, N> buffer;
 };
 
+/**
+ * @brief Self-contained fixed-size ring buffer.
+ *
+ * Same API as RingBuffer, but the capacity is a compile-time constant instead
+ * of a span and head/tail/count use the smallest unsigned type that holds N,
+ * e.g. 2 bytes of bookkeeping for StaticRingBuffer<char, 64> instead of a
+ * span and two or three size_t. Bounds math folds to constants. Power of two
+ * capacities use mask-based indexing.
+ *
+ * With RingBufferElements::non_trivial, T may be any nothrow move
+ * constructible type: elements are constructed on push/emplace and destroyed
+ * on pop, discard, clear, overwrite and destruction. writable_span() and
+ * commit() are unavailable in that mode as they expose unconstructed slots.
+ *
+ * @note Not convertible to RingBufferView; use RingBuffer where an interface
+ * over arbitrary storage is needed.
+ */
+template <typename T, size_t N, RingBufferElements elements = RingBufferElements::trivial>
+class StaticRingBuffer
+    : public BasicRingBuffer<T, std::conditional_t<elements == RingBufferElements::trivial,
+                                                   detail::ArrayRingStorage<T, N>, detail::ObjectRingStorage<T, N>>> {
+    static_assert(N > 0, "StaticRingBuffer capacity N must be > 0");
+
+public:
+    using Base =
+        BasicRingBuffer<T, std::conditional_t<elements == RingBufferElements::trivial, detail::ArrayRingStorage<T, N>,
+                                              detail::ObjectRingStorage<T, N>>>;
+    StaticRingBuffer() noexcept = default;
+};
+
 } // namespace ln
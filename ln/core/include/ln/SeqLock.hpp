@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace ln {
+
+/**
+ * @brief Single-writer/many-reader sharing of a value through a sequence
+ * counter.
+ *
+ * The writer makes the counter odd, copies the value in and makes it even
+ * again; it never waits. Readers copy the value out and retry if the counter
+ * was odd or moved meanwhile, so they never block the writer and need no
+ * per-reader state, but may retry while a store() is under way. The value is
+ * kept as relaxed atomic words, so the racing copies are well defined.
+ *
+ * Best for small to medium, frequently read values. For a single reader that
+ * must never retry, or a T that is not trivially copyable, use TripleBuffer.
+ *
+ * @warning load() spins until it gets a consistent copy. On a single core a
+ * reader that preempts the writer mid store() spins until its time slice
+ * ends, so either store() from a context readers cannot preempt (an ISR or
+ * the highest priority task) or read with try_load() and back off.
+ *
+ * @note Concurrent store() calls must be serialized by the caller.
+ */
+template <typename T> class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock copies T as raw bytes");
+
+public:
+    SeqLock() noexcept : SeqLock(T{}) {}
+
+    explicit SeqLock(const T &initial) noexcept { this->write_words(initial); }
+
+    SeqLock(const SeqLock &) = delete;
+    SeqLock &operator=(const SeqLock &) = delete;
+
+    /**
+     * @brief Replace the value. Writer only; never blocks.
+     */
+    void store(const T &value) noexcept {
+        const std::uint32_t sequence = this->sequence.load(std::memory_order_relaxed);
+        this->sequence.store(sequence + 1, std::memory_order_relaxed);
+        // keeps the data stores below from moving above the odd sequence
+        std::atomic_thread_fence(std::memory_order_release);
+        this->write_words(value);
+        this->sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copy the value out in a single attempt. Safe from any number of
+     * readers.
+     *
+     * @return false if a store() got in the way; value is then unspecified.
+     */
+    [[nodiscard]] bool try_load(T &value) const noexcept {
+        const std::uint32_t before = this->sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            return false;
+        }
+        std::array<Word, word_count> copy;
+        for (size_t i = 0; i < word_count; ++i) {
+            copy[i] = this->words[i].load(std::memory_order_relaxed);
+        }
+        // keeps the data loads above from moving below the second sequence read
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (this->sequence.load(std::memory_order_relaxed) != before) {
+            return false;
+        }
+        std::memcpy(&value, copy.data(), sizeof(T));
+        return true;
+    }
+
+    /**
+     * @brief Returns a consistent copy of the value, retrying while store()
+     * runs. Safe from any number of readers; see the class warning.
+     */
+    [[nodiscard]] T load() const noexcept {
+        T value;
+        while (!this->try_load(value)) {
+        }
+        return value;
+    }
+
+    /**
+     * @brief Returns the number of completed store() calls, e.g. to tell
+     * whether the value changed since the last load().
+     */
+    [[nodiscard]] std::uint32_t get_version() const noexcept {
+        return this->sequence.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    using Word = std::uint32_t;
+    static constexpr size_t word_count = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+    void write_words(const T &value) noexcept {
+        std::array<Word, word_count> copy{};
+        std::memcpy(copy.data(), &value, sizeof(T));
+        for (size_t i = 0; i < word_count; ++i) {
+            this->words[i].store(copy[i], std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<std::uint32_t> sequence{0};
+    std::array<std::atomic<Word>, word_count> words;
+};
+
+} // namespace ln
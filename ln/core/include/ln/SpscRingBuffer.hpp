@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/cache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace ln {
+
+/**
+ * @brief Lock-free single-producer/single-consumer ring buffer interface for
+ * externally provided storage.
+ *
+ * Exactly one context (e.g. an ISR) may push and exactly one other context
+ * (e.g. a task) may pop concurrently without any critical section. Indices run
+ * over [0, 2 * capacity) so full and empty states are distinguishable without a
+ * shared element count and without sacrificing a storage slot. Head is written
+ * by the consumer only and tail by the producer only, each on its own cache
+ * line.
+ *
+ * @note Unlike RingBufferView, there is no overwrite mode: the producer never
+ * touches the consumer-owned head.
+ */
+template <typename T> class SpscRingBufferView {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "SpscRingBufferView requires trivially destructible T for embedded safety");
+    static_assert(std::atomic<size_t>::is_always_lock_free, "SpscRingBufferView requires lock-free size_t atomics");
+
+public:
+    /**
+     * @brief Construct a ring buffer over the given span.
+     *
+     * The size of the span defines the capacity of the ring buffer.
+     */
+    explicit SpscRingBufferView(std::span<T> backing_storage) noexcept : storage(backing_storage) {}
+
+    SpscRingBufferView(const SpscRingBufferView &) = delete;
+    SpscRingBufferView &operator=(const SpscRingBufferView &) = delete;
+
+    /**
+     * @brief Returns the number of elements stored in the buffer. Exact when
+     * called from the producer or consumer, a snapshot otherwise.
+     */
+    [[nodiscard]] size_t size() const noexcept {
+        return this->distance(this->head.load(std::memory_order_acquire), this->tail.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Returns the capacity of the buffer.
+     */
+    [[nodiscard]] size_t capacity() const noexcept { return this->storage.size(); }
+
+    /**
+     * @brief Returns true if no elements are stored.
+     */
+    [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
+
+    /**
+     * @brief Returns true if the buffer cannot accept more elements.
+     */
+    [[nodiscard]] bool full() const noexcept { return this->size() == this->capacity(); }
+
+    /**
+     * @brief Returns how many elements can still be inserted.
+     */
+    [[nodiscard]] size_t get_free_space() const noexcept { return this->capacity() - this->size(); }
+
+    /**
+     * @brief Try to push an element to the back of the buffer. Producer only.
+     *
+     * @return false if the buffer is already full.
+     */
+    bool push(const T &value) noexcept {
+        const size_t tail = this->tail.load(std::memory_order_relaxed);
+        const size_t head = this->head.load(std::memory_order_acquire);
+        if (this->distance(head, tail) == this->capacity()) {
+            return false;
+        }
+        this->storage[this->physical(tail)] = value;
+        this->tail.store(this->next(tail, 1), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Try to push all elements to the back of the buffer. Producer only.
+     *
+     * @return false if there is not enough space for all elements, in which
+     * case nothing is pushed.
+     */
+    bool push(const std::span<const T> &values) noexcept {
+        const size_t to_push = values.size();
+        if (to_push == 0) {
+            return true;
+        }
+        const size_t tail = this->tail.load(std::memory_order_relaxed);
+        const size_t head = this->head.load(std::memory_order_acquire);
+        if (to_push > this->capacity() - this->distance(head, tail)) {
+            return false;
+        }
+        const size_t physical_tail = this->physical(tail);
+        const size_t first_chunk_size = std::min(to_push, this->capacity() - physical_tail);
+        std::copy_n(values.data(), first_chunk_size, &this->storage[physical_tail]);
+        std::copy_n(values.data() + first_chunk_size, to_push - first_chunk_size, this->storage.data());
+        this->tail.store(this->next(tail, to_push), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Largest contiguous free region at the back of the buffer. Fill it
+     * directly (e.g. by DMA) and publish the written elements with commit().
+     * Producer only.
+     */
+    [[nodiscard]] std::span<T> writable_span() noexcept {
+        const size_t tail = this->tail.load(std::memory_order_relaxed);
+        const size_t head = this->head.load(std::memory_order_acquire);
+        const size_t start = this->physical(tail);
+        return this->storage.subspan(
+            start, std::min(this->capacity() - this->distance(head, tail), this->capacity() - start));
+    }
+
+    /**
+     * @brief Publish count elements previously written into writable_span().
+     * Producer only.
+     *
+     * @return false if count exceeds the writable_span() size.
+     */
+    bool commit(size_t count) noexcept {
+        if (count > this->writable_span().size()) {
+            return false;
+        }
+        const size_t tail = this->tail.load(std::memory_order_relaxed);
+        this->tail.store(this->next(tail, count), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop the oldest element. Consumer only.
+     *
+     * @return std::optional containing the value, or std::nullopt if the buffer is empty.
+     */
+    [[nodiscard]] std::optional<T> pop() noexcept {
+        const size_t head = this->head.load(std::memory_order_relaxed);
+        const size_t tail = this->tail.load(std::memory_order_acquire);
+        if (head == tail) {
+            return std::nullopt;
+        }
+        T value = this->storage[this->physical(head)];
+        this->head.store(this->next(head, 1), std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief Stored elements in FIFO order as up to two contiguous regions. The
+     * second span is empty unless the data wraps around the end of storage.
+     * Release the processed elements with consume(). Consumer only.
+     */
+    [[nodiscard]] std::array<std::span<T>, 2> readable_spans() noexcept {
+        const size_t head = this->head.load(std::memory_order_relaxed);
+        const size_t used = this->distance(head, this->tail.load(std::memory_order_acquire));
+        const size_t start = this->physical(head);
+        const size_t first_chunk_size = std::min(used, this->capacity() - start);
+        return {this->storage.subspan(start, first_chunk_size), this->storage.first(used - first_chunk_size)};
+    }
+
+    /**
+     * @brief Release count oldest elements after reading them via
+     * readable_spans(). Consumer only.
+     *
+     * @return false if fewer than count elements are stored.
+     */
+    bool consume(size_t count) noexcept {
+        const size_t head = this->head.load(std::memory_order_relaxed);
+        if (count > this->distance(head, this->tail.load(std::memory_order_acquire))) {
+            return false;
+        }
+        this->head.store(this->next(head, count), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove all elements from the buffer. Consumer only.
+     */
+    void clear() noexcept {
+        this->head.store(this->tail.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    [[nodiscard]] size_t distance(size_t from, size_t to) const noexcept {
+        return to >= from ? to - from : to + 2 * this->capacity() - from;
+    }
+
+    [[nodiscard]] size_t physical(size_t index) const noexcept {
+        return index < this->capacity() ? index : index - this->capacity();
+    }
+
+    [[nodiscard]] size_t next(size_t index, size_t step) const noexcept {
+        index += step;
+        return index < 2 * this->capacity() ? index : index - 2 * this->capacity();
+    }
+
+    std::span<T> storage;
+    alignas(cache_line_size) std::atomic<size_t> head{0}; // index of oldest element, written by consumer
+    alignas(cache_line_size) std::atomic<size_t> tail{0}; // index one past newest element, written by producer
+};
+
+/**
+ * @brief Owning fixed-size SPSC ring buffer with internal static storage.
+ */
+template <typename T, size_t N> class SpscRingBuffer : public SpscRingBufferView<T> {
+    static_assert(N > 0, "SpscRingBuffer capacity N must be > 0");
+
+public:
+    using Base = SpscRingBufferView<T>;
+    SpscRingBuffer() noexcept : Base{buffer} {}
+
+private:
+    std::array<T, N> buffer;
+};
+
+} // namespace ln
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace ln {
+
+/**
+ * @brief Default hash of StaticHashMap: a multiplicative mix for integers,
+ * enums and pointers.
+ */
+template <typename K> struct Hash {
+    static_assert(std::is_integral_v<K> || std::is_enum_v<K> || std::is_pointer_v<K>,
+                  "no ln::Hash for this key type, provide one");
+
+    constexpr size_t operator()(const K &key) const noexcept {
+        std::uint64_t x;
+        if constexpr (std::is_pointer_v<K>) {
+            x = reinterpret_cast<std::uintptr_t>(key);
+        }
+        else {
+            x = static_cast<std::uint64_t>(key);
+        }
+        // Fibonacci hashing spreads sequential keys across the table
+        x *= 0x9E3779B97F4A7C15u;
+        return static_cast<size_t>(x ^ (x >> 32));
+    }
+};
+
+/**
+ * @brief FNV-1a string hash, transparent so string_view keys can be looked up
+ * with anything convertible to std::string_view.
+ */
+template <> struct Hash<std::string_view> {
+    using is_transparent = void;
+
+    constexpr size_t operator()(std::string_view key) const noexcept {
+        std::uint32_t hash = 2166136261u;
+        for (const char c : key) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+        }
+        return hash;
+    }
+};
+
+/**
+ * @brief Fixed-capacity hash map of up to N elements stored inline, with
+ * Robin Hood linear probing.
+ *
+ * Never allocates and can be constant-initialized (constinit), so it can be
+ * filled by static constructors in any order. Each element remembers its
+ * distance from its home slot; insertion lets the element furthest from home
+ * keep a slot, which keeps probe sequences short even when nearly full, and
+ * a lookup stops as soon as it passes where its key would have been.
+ * erase() shifts the following elements back instead of leaving tombstones,
+ * so the map does not degrade with churn.
+ *
+ * With a transparent Hash and KeyEqual, find(), contains() and erase() accept
+ * any type comparable with K, e.g. a std::string_view for StaticString keys.
+ *
+ * @note K and V must be default constructible; free slots hold default
+ * constructed keys and values. Pointers to values are invalidated by insert()
+ * and erase().
+ */
+template <typename K, typename V, size_t N, typename HashFn = Hash<K>, typename KeyEqual = std::equal_to<>>
+class StaticHashMap {
+    static_assert(N > 0 && N < std::numeric_limits<std::uint16_t>::max(), "StaticHashMap capacity N out of range");
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+
+    constexpr StaticHashMap() noexcept = default;
+
+    /**
+     * @brief Insert key with value unless key is already present.
+     *
+     * @return false if key is present or the map is full.
+     */
+    constexpr bool insert(const K &key, V value) noexcept {
+        if (this->find_index(key) != npos) {
+            return false;
+        }
+        return this->emplace_new(key, std::move(value));
+    }
+
+    /**
+     * @brief Insert key with value, or replace the value if key is present.
+     *
+     * @return false if key is not present and the map is full.
+     */
+    constexpr bool insert_or_assign(const K &key, V value) noexcept {
+        const size_t index = this->find_index(key);
+        if (index != npos) {
+            this->slots[index].value = std::move(value);
+            return true;
+        }
+        return this->emplace_new(key, std::move(value));
+    }
+
+    /**
+     * @brief Returns the value of key, or nullptr if not present.
+     */
+    template <typename Q> [[nodiscard]] constexpr V *find(const Q &key) noexcept {
+        const size_t index = this->find_index(key);
+        return index == npos ? nullptr : &this->slots[index].value;
+    }
+
+    template <typename Q> [[nodiscard]] constexpr const V *find(const Q &key) const noexcept {
+        const size_t index = this->find_index(key);
+        return index == npos ? nullptr : &this->slots[index].value;
+    }
+
+    template <typename Q> [[nodiscard]] constexpr bool contains(const Q &key) const noexcept {
+        return this->find_index(key) != npos;
+    }
+
+    /**
+     * @brief Remove key.
+     *
+     * @return false if key was not present.
+     */
+    template <typename Q> constexpr bool erase(const Q &key) noexcept {
+        size_t index = this->find_index(key);
+        if (index == npos) {
+            return false;
+        }
+        // shift the rest of the cluster back a slot, each one closer to home
+        for (size_t next = wrap(index + 1); this->slots[next].distance > 1; next = wrap(next + 1)) {
+            this->slots[index].key = std::move(this->slots[next].key);
+            this->slots[index].value = std::move(this->slots[next].value);
+            this->slots[index].distance = this->slots[next].distance - 1;
+            index = next;
+        }
+        this->slots[index] = Slot{};
+        --this->count;
+        return true;
+    }
+
+    constexpr void clear() noexcept {
+        for (Slot &slot : this->slots) {
+            slot = Slot{};
+        }
+        this->count = 0;
+    }
+
+    /**
+     * @brief Call fn(key, value) for every element, in no particular order.
+     */
+    template <typename F> constexpr void for_each(F &&fn) const {
+        for (const Slot &slot : this->slots) {
+            if (slot.distance) {
+                fn(slot.key, slot.value);
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr size_t size() const noexcept { return this->count; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return this->count == 0; }
+    [[nodiscard]] constexpr bool full() const noexcept { return this->count == N; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return N; }
+
+    /**
+     * @brief Returns the longest probe sequence, in slots, any present key
+     * takes to find.
+     */
+    [[nodiscard]] constexpr size_t get_max_probe_length() const noexcept {
+        size_t longest = 0;
+        for (const Slot &slot : this->slots) {
+            longest = std::max<size_t>(longest, slot.distance);
+        }
+        return longest;
+    }
+
+private:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    struct Slot {
+        K key{};
+        V value{};
+        std::uint16_t distance = 0; ///< probe length from the home slot, 0 if free
+    };
+
+    static constexpr size_t wrap(size_t index) noexcept { return index == N ? 0 : index; }
+
+    template <typename Q> static constexpr size_t home_of(const Q &key) noexcept { return HashFn{}(key) % N; }
+
+    template <typename Q> constexpr size_t find_index(const Q &key) const noexcept {
+        size_t index = home_of(key);
+        for (std::uint16_t distance = 1; distance <= this->slots[index].distance; ++distance) {
+            if (this->slots[index].distance == distance && KeyEqual{}(this->slots[index].key, key)) {
+                return index;
+            }
+            index = wrap(index + 1);
+        }
+        return npos;
+    }
+
+    constexpr bool emplace_new(K key, V value) noexcept {
+        if (this->full()) {
+            return false;
+        }
+        size_t index = home_of(key);
+        std::uint16_t distance = 1;
+        while (this->slots[index].distance) {
+            if (this->slots[index].distance < distance) {
+                // take from the richer element, carry it on
+                std::swap(key, this->slots[index].key);
+                std::swap(value, this->slots[index].value);
+                std::swap(distance, this->slots[index].distance);
+            }
+            index = wrap(index + 1);
+            ++distance;
+        }
+        this->slots[index].key = std::move(key);
+        this->slots[index].value = std::move(value);
+        this->slots[index].distance = distance;
+        ++this->count;
+        return true;
+    }
+
+    std::array<Slot, N> slots{};
+    size_t count = 0;
+};
+
+} // namespace ln
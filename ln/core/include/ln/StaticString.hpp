@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+namespace ln {
+
+/**
+ * @brief String builder over externally provided storage, kept
+ * null-terminated so c_str() is always valid.
+ *
+ * Appending never allocates: whatever does not fit is cut off and the append
+ * returns false, leaving the string full. Formatted appends print directly
+ * into the free space.
+ *
+ * @note The capacity is one less than the storage size, for the terminator.
+ */
+class StringBuffer {
+public:
+    explicit StringBuffer(std::span<char> backing_storage) noexcept : storage(backing_storage) {
+        if (!this->storage.empty()) {
+            this->storage[0] = '\0';
+        }
+    }
+
+    StringBuffer(const StringBuffer &) = delete;
+    StringBuffer &operator=(const StringBuffer &) = delete;
+
+    [[nodiscard]] size_t capacity() const noexcept { return this->storage.empty() ? 0 : this->storage.size() - 1; }
+    [[nodiscard]] size_t size() const noexcept { return this->length; }
+    [[nodiscard]] bool empty() const noexcept { return this->length == 0; }
+    [[nodiscard]] bool full() const noexcept { return this->length == this->capacity(); }
+
+    [[nodiscard]] char *data() noexcept { return this->storage.data(); }
+    [[nodiscard]] const char *data() const noexcept { return this->storage.data(); }
+    [[nodiscard]] const char *c_str() const noexcept { return this->storage.empty() ? "" : this->storage.data(); }
+
+    [[nodiscard]] std::string_view view() const noexcept { return {this->storage.data(), this->length}; }
+    operator std::string_view() const noexcept { return this->view(); }
+
+    [[nodiscard]] std::span<const char> span() const noexcept { return {this->storage.data(), this->length}; }
+
+    [[nodiscard]] char &operator[](size_t index) noexcept { return this->storage[index]; }
+    [[nodiscard]] char operator[](size_t index) const noexcept { return this->storage[index]; }
+
+    /**
+     * @brief Append as much of sv as fits.
+     *
+     * @return false if sv was cut off.
+     */
+    bool append(std::string_view sv) noexcept {
+        const size_t appended = std::min(sv.size(), this->capacity() - this->length);
+        std::memcpy(this->storage.data() + this->length, sv.data(), appended);
+        this->set_length(this->length + appended);
+        return appended == sv.size();
+    }
+
+    /**
+     * @brief Append count copies of c, as many as fit.
+     *
+     * @return false if not all copies fit.
+     */
+    bool append(char c, size_t count = 1) noexcept {
+        const size_t appended = std::min(count, this->capacity() - this->length);
+        std::memset(this->storage.data() + this->length, c, appended);
+        this->set_length(this->length + appended);
+        return appended == count;
+    }
+
+    /**
+     * @brief Append printf-style formatted text, as much as fits.
+     *
+     * @return false if the text was cut off or could not be formatted.
+     */
+    [[gnu::format(printf, 2, 3)]] bool appendf(const char *fmt, ...) noexcept {
+        va_list args;
+        va_start(args, fmt);
+        const bool fits = this->vappendf(fmt, args);
+        va_end(args);
+        return fits;
+    }
+
+    [[gnu::format(printf, 2, 0)]] bool vappendf(const char *fmt, va_list args) noexcept {
+        if (this->storage.empty()) {
+            return false;
+        }
+        const size_t free_space = this->storage.size() - this->length;
+        const int printed = std::vsnprintf(this->storage.data() + this->length, free_space, fmt, args);
+        if (printed < 0) {
+            this->storage[this->length] = '\0';
+            return false;
+        }
+        this->length += std::min(static_cast<size_t>(printed), free_space - 1);
+        return static_cast<size_t>(printed) < free_space;
+    }
+
+    /**
+     * @brief Insert c before position, shifting the rest back.
+     *
+     * @return false if full or position is past the end.
+     */
+    bool insert(size_t position, char c) noexcept {
+        if (this->full() || position > this->length) {
+            return false;
+        }
+        std::memmove(this->storage.data() + position + 1, this->storage.data() + position, this->length - position);
+        this->storage[position] = c;
+        this->set_length(this->length + 1);
+        return true;
+    }
+
+    /**
+     * @brief Remove up to count characters starting at position, shifting the
+     * rest forward.
+     */
+    void erase(size_t position, size_t count = 1) noexcept {
+        if (position >= this->length) {
+            return;
+        }
+        count = std::min(count, this->length - position);
+        std::memmove(this->storage.data() + position, this->storage.data() + position + count,
+                     this->length - position - count);
+        this->set_length(this->length - count);
+    }
+
+    /**
+     * @brief Shorten to at most length characters.
+     */
+    void truncate(size_t length) noexcept {
+        if (length < this->length) {
+            this->set_length(length);
+        }
+    }
+
+    void clear() noexcept { this->truncate(0); }
+
+    bool operator==(std::string_view sv) const noexcept { return this->view() == sv; }
+
+private:
+    void set_length(size_t length) noexcept {
+        this->length = length;
+        if (!this->storage.empty()) {
+            this->storage[length] = '\0';
+        }
+    }
+
+    std::span<char> storage;
+    size_t length = 0;
+};
+
+/**
+ * @brief Owning StringBuffer of up to N characters.
+ */
+template <size_t N> class StaticString : public StringBuffer {
+public:
+    StaticString() noexcept : StringBuffer{buffer} {}
+
+    explicit StaticString(std::string_view sv) noexcept : StaticString{} { (void)this->append(sv); }
+
+    StaticString(const StaticString &other) noexcept : StaticString{other.view()} {}
+
+    StaticString &operator=(const StaticString &other) noexcept {
+        if (this != &other) {
+            this->clear();
+            (void)this->append(other.view());
+        }
+        return *this;
+    }
+
+    StaticString &operator=(std::string_view sv) noexcept {
+        this->clear();
+        (void)this->append(sv);
+        return *this;
+    }
+
+private:
+    std::array<char, N + 1> buffer;
+};
+
+} // namespace ln
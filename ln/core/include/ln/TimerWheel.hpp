@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/InplaceFunction.hpp"
+#include "ln/ln.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace ln {
+
+class TimerWheel;
+
+/**
+ * @brief Intrusive one-shot or periodic timer, armed on a TimerWheel.
+ *
+ * The timer is linked into the wheel by its own pointers, so arming and
+ * cancelling never allocate. A Timer must outlive its time on the wheel.
+ */
+class Timer {
+public:
+    using Callback = InplaceFunction<void()>;
+
+    struct Stats {
+        size_t fired;                ///< callbacks run
+        size_t overruns;             ///< periods skipped because the callback ran too late
+        std::uint32_t last_lateness; ///< ticks between expiry and running the last callback
+        std::uint32_t max_lateness;  ///< high-water mark of last_lateness
+    };
+
+    Timer() noexcept = default;
+    explicit Timer(Callback callback) noexcept : callback(std::move(callback)) {}
+
+    Timer(const Timer &) = delete;
+    Timer &operator=(const Timer &) = delete;
+
+    ~Timer() { LN_ASSERT_PANIC(!this->is_active()); }
+
+    /**
+     * @brief Replace the callback. Not while the timer is active.
+     */
+    void set_callback(Callback new_callback) noexcept {
+        LN_ASSERT_PANIC(!this->is_active());
+        this->callback = std::move(new_callback);
+    }
+
+    [[nodiscard]] bool is_active() const noexcept { return this->pprev != nullptr; }
+    [[nodiscard]] std::uint32_t get_period() const noexcept { return this->period; }
+    [[nodiscard]] Stats get_stats() const noexcept { return this->stats; }
+
+private:
+    friend class TimerWheel;
+
+    Callback callback;
+    Timer *next = nullptr;
+    Timer **pprev = nullptr; ///< link pointing at this, nullptr while inactive
+    std::uint32_t expires = 0;
+    std::uint32_t period = 0;
+    Stats stats{};
+};
+
+/**
+ * @brief Hierarchical timer wheel: O(1) start and cancel for any number of
+ * timers, driven by a single tick source.
+ *
+ * Four levels of 64 slots cover 2^24 ticks; level 0 holds timers due within
+ * 64 ticks, each higher level 64 times the span of the one below. When the
+ * slot index of a level wraps, the next slot of the level above is cascaded
+ * down, so a timer is moved at most three times before it fires. Longer
+ * delays wait in the top level and are re-filed when it cascades.
+ *
+ * tick() is safe from any context, e.g. a hardware timer ISR or the FreeRTOS
+ * tick hook. It only counts, and calls ll_notify() once the next due tick
+ * published by run_pending() is reached; the wheel advances and the callbacks
+ * run in run_pending(), called by the service that owns the wheel. Idle ticks
+ * thus never wake the service: it wakes when a timer expires and, while
+ * timers are armed further out than level 0, at most every 64 ticks to
+ * cascade. Callbacks that need a different context can post to a
+ * DeferredExecutor.
+ *
+ * Lateness, the ticks between a timer's expiry and its callback running, is
+ * the jitter added by the service. A periodic timer that falls a whole period
+ * behind skips the missed expiries and counts them as overruns.
+ *
+ * Derived classes provide the service, see ln::drivers::TimerTask.
+ *
+ * @note start(), cancel() and run_pending() must be called from the service's
+ * context (callbacks included). Post from other contexts. Between wakeups
+ * get_now() lags the tick source, so call run_pending() before start() outside
+ * of callbacks.
+ */
+class TimerWheel {
+public:
+    static constexpr size_t level_count = 4;
+    static constexpr size_t slot_bits = 6;
+    static constexpr size_t slot_count = 1 << slot_bits;
+    /// longest delay filed exactly, longer ones are re-filed on the way
+    static constexpr std::uint32_t max_span = (1u << (slot_bits * level_count)) - 1;
+    /// delays and periods must stay below this for wrapping tick math
+    static constexpr std::uint32_t max_delay = std::uint32_t{1} << 31;
+
+    struct Stats {
+        size_t active;               ///< timers on the wheel
+        size_t fired;                ///< callbacks run
+        size_t overruns;             ///< periods skipped, see Timer::Stats
+        std::uint32_t max_lateness;  ///< worst lateness of any callback
+        std::uint32_t pending_ticks; ///< ticks counted but not processed yet
+    };
+
+    TimerWheel() noexcept = default;
+    TimerWheel(const TimerWheel &) = delete;
+    TimerWheel &operator=(const TimerWheel &) = delete;
+    virtual ~TimerWheel() = default;
+
+    /**
+     * @brief Arm timer to fire delay ticks after the wheel's current tick,
+     * then every period ticks if period is not 0. Re-arms an active timer.
+     *
+     * @note A delay of 0 fires on the next processed tick.
+     */
+    void start(Timer &timer, std::uint32_t delay, std::uint32_t period = 0) noexcept {
+        LN_ASSERT_PANIC(delay < max_delay && period < max_delay);
+        (void)this->cancel(timer);
+        timer.expires = this->now + (delay == 0 ? 1 : delay);
+        timer.period = period;
+        this->insert(timer);
+        ++this->active;
+        if (!is_reached(timer.expires, this->next_due.load(std::memory_order_relaxed))) {
+            this->next_due.store(timer.expires);
+        }
+    }
+
+    /**
+     * @brief Disarm timer.
+     *
+     * @return false if the timer was not active.
+     */
+    bool cancel(Timer &timer) noexcept {
+        if (!timer.is_active()) {
+            return false;
+        }
+        unlink(timer);
+        --this->active;
+        return true;
+    }
+
+    /**
+     * @brief Count one tick of the tick source and wake the service if the
+     * wheel has work due. Safe from any context.
+     */
+    void tick() noexcept {
+        const std::uint32_t ticked = this->ticks.fetch_add(1) + 1;
+        if (is_reached(ticked, this->next_due.load())) {
+            this->ll_notify();
+        }
+    }
+
+    /**
+     * @brief Advance the wheel over every tick counted so far, running the
+     * callbacks of the timers that expire, and publish the next due tick.
+     * Service context only.
+     *
+     * @return Number of callbacks run.
+     */
+    size_t run_pending() noexcept {
+        size_t fired = 0;
+        while (true) {
+            for (std::uint32_t latest = 0; this->now != (latest = this->ticks.load(std::memory_order_acquire));) {
+                if (this->active == 0) {
+                    // nothing to cascade or fire, skip idle ticks at once
+                    this->now = latest;
+                    break;
+                }
+                fired += this->advance();
+            }
+            const std::uint32_t due = this->get_next_due();
+            this->next_due.store(due);
+            // a tick that reached due before it was published did not notify
+            if (!is_reached(this->ticks.load(), due)) {
+                return fired;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the last tick processed by run_pending().
+     */
+    [[nodiscard]] std::uint32_t get_now() const noexcept { return this->now; }
+
+    [[nodiscard]] Stats get_stats() const noexcept {
+        return {this->active, this->fired, this->overruns, this->max_lateness,
+                this->ticks.load(std::memory_order_relaxed) - this->now};
+    }
+
+protected:
+    /**
+     * @brief Wake the service to call run_pending(). Called from tick(), in
+     * any context.
+     */
+    virtual void ll_notify() = 0;
+
+private:
+    static constexpr std::uint32_t slot_mask = slot_count - 1;
+
+    static constexpr bool is_reached(std::uint32_t tick, std::uint32_t due) noexcept {
+        return static_cast<std::int32_t>(tick - due) >= 0;
+    }
+
+    /**
+     * @brief Returns the next tick with work: the first occupied level 0 slot,
+     * else the next cascade, which happens whenever the level 0 slot index
+     * wraps.
+     */
+    [[nodiscard]] std::uint32_t get_next_due() const noexcept {
+        if (this->active == 0) {
+            return this->now + max_delay;
+        }
+        const std::uint32_t cascade_at = (this->now | slot_mask) + 1;
+        for (std::uint32_t due = this->now + 1; due != cascade_at; ++due) {
+            if (this->wheel[0][due & slot_mask]) {
+                return due;
+            }
+        }
+        return cascade_at;
+    }
+
+    static void unlink(Timer &timer) noexcept {
+        *timer.pprev = timer.next;
+        if (timer.next) {
+            timer.next->pprev = timer.pprev;
+        }
+        timer.next = nullptr;
+        timer.pprev = nullptr;
+    }
+
+    void insert(Timer &timer) noexcept {
+        // expired timers (delta 0) land in the current slot, processed next
+        std::uint32_t expires = timer.expires;
+        const std::uint32_t delta = expires - this->now;
+        if (delta > max_span) {
+            expires = this->now + max_span;
+        }
+        size_t level = 0;
+        while (level + 1 < level_count && (expires - this->now) >> (slot_bits * (level + 1))) {
+            ++level;
+        }
+        Timer *&head = this->wheel[level][(expires >> (slot_bits * level)) & slot_mask];
+        timer.next = head;
+        timer.pprev = &head;
+        if (head) {
+            head->pprev = &timer.next;
+        }
+        head = &timer;
+    }
+
+    void cascade(size_t level) noexcept {
+        Timer *&head = this->wheel[level][(this->now >> (slot_bits * level)) & slot_mask];
+        Timer *timer = std::exchange(head, nullptr);
+        while (timer) {
+            Timer *next = timer->next;
+            timer->pprev = nullptr;
+            this->insert(*timer);
+            timer = next;
+        }
+    }
+
+    size_t advance() noexcept {
+        ++this->now;
+        for (size_t level = 1; level < level_count; ++level) {
+            if ((this->now >> (slot_bits * (level - 1))) & slot_mask) {
+                break;
+            }
+            this->cascade(level);
+        }
+
+        size_t fired = 0;
+        Timer *&slot = this->wheel[0][this->now & slot_mask];
+        while (Timer *timer = slot) {
+            unlink(*timer);
+            --this->active;
+            this->expire(*timer);
+            ++fired;
+        }
+        return fired;
+    }
+
+    void expire(Timer &timer) noexcept {
+        const std::uint32_t latest = this->ticks.load(std::memory_order_relaxed);
+        const std::uint32_t lateness = latest - timer.expires;
+        timer.stats.last_lateness = lateness;
+        if (lateness > timer.stats.max_lateness) {
+            timer.stats.max_lateness = lateness;
+        }
+        if (lateness > this->max_lateness) {
+            this->max_lateness = lateness;
+        }
+
+        if (timer.period) {
+            // re-arm first so the callback may cancel or restart the timer
+            std::uint32_t next = timer.expires + timer.period;
+            if (lateness >= timer.period) {
+                const std::uint32_t skipped = lateness / timer.period;
+                next += skipped * timer.period;
+                timer.stats.overruns += skipped;
+                this->overruns += skipped;
+            }
+            timer.expires = next;
+            this->insert(timer);
+            ++this->active;
+        }
+
+        ++timer.stats.fired;
+        ++this->fired;
+        timer.callback();
+    }
+
+    std::array<std::array<Timer *, slot_count>, level_count> wheel{};
+    std::atomic<std::uint32_t> ticks{0};
+    std::atomic<std::uint32_t> next_due{max_delay}; ///< tick() notifies from this tick on
+    std::uint32_t now = 0;
+    size_t active = 0;
+    size_t fired = 0;
+    size_t overruns = 0;
+    std::uint32_t max_lateness = 0;
+};
+
+} // namespace ln
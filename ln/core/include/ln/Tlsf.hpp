@@ -0,0 +1,589 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/ln.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <span>
+
+namespace ln {
+
+/**
+ * @brief Two-level segregated fit (TLSF) allocator over externally provided
+ * storage.
+ *
+ * Free blocks are kept in segregated lists indexed by a first level (power of
+ * two) and a second level (linear subdivision of that power of two). Two
+ * bitmaps record which lists are non-empty, so finding a fitting block is a
+ * couple of bit scans instead of a list walk, and neighbouring free blocks are
+ * merged immediately on deallocate(). Both allocate() and deallocate() are
+ * therefore O(1) with a small, bounded worst case regardless of fragmentation.
+ *
+ * Each allocated block costs header_overhead bytes; payloads are aligned to
+ * alignment. The free list heads take about 1.2 KiB on 32-bit targets, where a
+ * single block is limited to 16 MiB.
+ *
+ * @note Not thread-safe.
+ */
+class Tlsf {
+private:
+    static constexpr size_t alignment_log2 = 3;
+
+public:
+    static constexpr size_t alignment = size_t{1} << alignment_log2;
+    static constexpr size_t header_overhead = std::max(alignment, sizeof(size_t));
+
+    /**
+     * @brief Construct an allocator managing backing_storage as one block.
+     * Storage too small to hold a block leaves the allocator empty.
+     */
+    explicit Tlsf(std::span<std::byte> backing_storage) noexcept {
+        this->null_block.next_free = &this->null_block;
+        this->null_block.prev_free = &this->null_block;
+        for (auto &lists : this->blocks) {
+            lists.fill(&this->null_block);
+        }
+
+        const auto begin = reinterpret_cast<std::uintptr_t>(backing_storage.data());
+        const std::uintptr_t payload = align_up(begin + payload_offset);
+        const std::uintptr_t end = begin + backing_storage.size();
+        if (payload > end || end - payload < header_overhead + block_size_min) {
+            return;
+        }
+        // the last header_overhead bytes hold the zero-sized sentinel ending the physical block chain
+        const size_t size = std::min((end - payload - header_overhead) & ~(alignment - 1), block_size_max - alignment);
+
+        Block *block = Block::from_payload(reinterpret_cast<void *>(payload));
+        block->size_and_flags = size | free_bit;
+        Block *sentinel = block->link_next();
+        sentinel->size_and_flags = prev_free_bit;
+        this->insert_free_block(block);
+
+        this->first_block = block;
+        this->total = size + header_overhead;
+        this->min_ever_free = this->total;
+    }
+
+    Tlsf(const Tlsf &) = delete;
+    Tlsf &operator=(const Tlsf &) = delete;
+
+    /**
+     * @brief Allocate size bytes aligned to alignment.
+     *
+     * @return Pointer to uninitialized memory, or nullptr if size is zero or
+     * no free block fits.
+     */
+    [[nodiscard]] void *allocate(size_t size) noexcept {
+        const size_t adjusted = adjust_request_size(size);
+        Block *block = this->locate_free(adjusted);
+        if (!block) {
+            return nullptr;
+        }
+        return this->prepare_used(block, adjusted);
+    }
+
+    /**
+     * @brief Allocate size bytes aligned to align (a power of two).
+     *
+     * Alignments above alignment reserve room for a leading free block, so
+     * they need a free block about align bytes larger than size.
+     */
+    [[nodiscard]] void *allocate(size_t size, size_t align) noexcept {
+        if (align <= alignment) {
+            return this->allocate(size);
+        }
+        const size_t adjusted = adjust_request_size(size);
+        if (!adjusted || !std::has_single_bit(align) || align >= block_size_max) {
+            return nullptr;
+        }
+        Block *block = this->locate_free(adjust_request_size(adjusted + align + gap_min));
+        if (!block) {
+            return nullptr;
+        }
+        const auto payload = reinterpret_cast<std::uintptr_t>(block->payload());
+        std::uintptr_t aligned = align_up(payload, align);
+        if (aligned != payload && aligned - payload < gap_min) {
+            aligned = align_up(payload + gap_min, align);
+        }
+        if (aligned != payload) {
+            block = this->trim_free_leading(block, aligned - payload);
+        }
+        return this->prepare_used(block, adjusted);
+    }
+
+    /**
+     * @brief Return memory obtained from allocate(). nullptr is ignored.
+     */
+    void deallocate(void *pointer) noexcept {
+        if (!pointer) {
+            return;
+        }
+        Block *block = Block::from_payload(pointer);
+        LN_ASSERT_PANIC(!block->is_free());
+        this->used -= block->size() + header_overhead;
+        ++this->frees;
+        this->mark_as_free(block);
+        block = this->merge_prev(block);
+        block = this->merge_next(block);
+        this->insert_free_block(block);
+    }
+
+    /**
+     * @brief Returns the usable size of an allocation, at least the size
+     * requested.
+     */
+    [[nodiscard]] static size_t get_usable_size(const void *pointer) noexcept {
+        return Block::from_payload(const_cast<void *>(pointer))->size();
+    }
+
+    /**
+     * @brief Returns the number of bytes managed, including block headers.
+     */
+    [[nodiscard]] size_t capacity() const noexcept { return this->total; }
+
+    /**
+     * @brief Returns the number of bytes not allocated, including headers of
+     * free blocks.
+     */
+    [[nodiscard]] size_t get_free_size() const noexcept { return this->total - this->used; }
+
+    /**
+     * @brief Returns the low-water mark of get_free_size().
+     */
+    [[nodiscard]] size_t get_min_ever_free_size() const noexcept { return this->min_ever_free; }
+
+    /**
+     * @brief Reset the low-water mark to the current free size.
+     */
+    void reset_min_ever_free_size() noexcept { this->min_ever_free = this->get_free_size(); }
+
+    struct Stats {
+        size_t free;               ///< bytes not allocated, including headers of free blocks
+        size_t largest_free_block; ///< largest single allocation that would currently succeed
+        size_t smallest_free_block;
+        size_t free_block_count;
+        size_t min_ever_free;   ///< low-water mark of free
+        size_t allocation_count; ///< successful allocate() calls
+        size_t free_count;       ///< deallocate() calls with a non-null pointer
+    };
+
+    /**
+     * @brief Snapshot of the heap state. Walks the free lists, so unlike
+     * allocation it is O(number of free blocks).
+     */
+    [[nodiscard]] Stats get_stats() const noexcept {
+        Stats stats{.free = this->get_free_size(),
+                    .largest_free_block = 0,
+                    .smallest_free_block = 0,
+                    .free_block_count = 0,
+                    .min_ever_free = this->min_ever_free,
+                    .allocation_count = this->allocations,
+                    .free_count = this->frees};
+        for (size_t fl = 0; fl < fl_index_count; ++fl) {
+            for (size_t sl = 0; sl < sl_index_count; ++sl) {
+                for (const Block *block = this->blocks[fl][sl]; block != &this->null_block; block = block->next_free) {
+                    stats.largest_free_block = std::max(stats.largest_free_block, block->size());
+                    stats.smallest_free_block = stats.free_block_count == 0
+                                                    ? block->size()
+                                                    : std::min(stats.smallest_free_block, block->size());
+                    ++stats.free_block_count;
+                }
+            }
+        }
+        return stats;
+    }
+
+    /**
+     * @brief Verify the heap structure: physical chain, flags, coalescing and
+     * free list membership. Meant for tests and debugging.
+     *
+     * @return false if the heap is corrupted.
+     */
+    [[nodiscard]] bool check() const noexcept {
+        if (!this->first_block) {
+            return this->fl_bitmap == 0;
+        }
+        size_t free_size = 0;
+        size_t free_count = 0;
+        bool prev_free = false;
+        const Block *block = this->first_block;
+        for (; !block->is_last(); block = block->next()) {
+            if (block->is_prev_free() != prev_free || (prev_free && block->is_free()) ||
+                block->size() % alignment != 0 || block->size() < block_size_min) {
+                return false;
+            }
+            if (block->is_free()) {
+                if (!this->is_listed(block)) {
+                    return false;
+                }
+                free_size += block->size() + header_overhead;
+                ++free_count;
+            }
+            prev_free = block->is_free();
+        }
+        if (block->is_prev_free() != prev_free || free_size != this->get_free_size()) {
+            return false;
+        }
+        // every listed block was reached through the physical chain
+        size_t listed_count = 0;
+        for (size_t fl = 0; fl < fl_index_count; ++fl) {
+            for (size_t sl = 0; sl < sl_index_count; ++sl) {
+                const bool has_blocks = this->blocks[fl][sl] != &this->null_block;
+                if (has_blocks != ((this->sl_bitmap[fl] >> sl) & 1U) ||
+                    (has_blocks && !((this->fl_bitmap >> fl) & 1U))) {
+                    return false;
+                }
+                for (const Block *free = this->blocks[fl][sl]; free != &this->null_block; free = free->next_free) {
+                    ++listed_count;
+                }
+            }
+        }
+        return listed_count == free_count;
+    }
+
+private:
+    static constexpr size_t sl_index_count_log2 = 4;
+    static constexpr size_t sl_index_count = size_t{1} << sl_index_count_log2;
+    static constexpr size_t fl_index_max = sizeof(size_t) > 4 ? 32 : 24;
+    static constexpr size_t fl_index_shift = sl_index_count_log2 + alignment_log2;
+    static constexpr size_t fl_index_count = fl_index_max - fl_index_shift + 1;
+    static constexpr size_t small_block_size = size_t{1} << fl_index_shift;
+
+    static constexpr size_t free_bit = 1U << 0;
+    static constexpr size_t prev_free_bit = 1U << 1;
+    static constexpr size_t flags_mask = free_bit | prev_free_bit;
+
+    /**
+     * @brief Block header. An allocated block only owns size_and_flags: its
+     * prev_physical field lies in the tail of the previous block and is valid
+     * only while that block is free, and the free list links overlap the
+     * payload.
+     */
+    struct Block {
+        Block *prev_physical;
+        union {
+            size_t size_and_flags;
+            std::byte header[header_overhead];
+        };
+        Block *next_free;
+        Block *prev_free;
+
+        [[nodiscard]] size_t size() const noexcept { return this->size_and_flags & ~flags_mask; }
+        void set_size(size_t size) noexcept { this->size_and_flags = size | (this->size_and_flags & flags_mask); }
+        [[nodiscard]] bool is_last() const noexcept { return this->size() == 0; }
+
+        [[nodiscard]] bool is_free() const noexcept { return this->size_and_flags & free_bit; }
+        void set_free(bool free) noexcept {
+            this->size_and_flags = free ? this->size_and_flags | free_bit : this->size_and_flags & ~free_bit;
+        }
+        [[nodiscard]] bool is_prev_free() const noexcept { return this->size_and_flags & prev_free_bit; }
+        void set_prev_free(bool free) noexcept {
+            this->size_and_flags =
+                free ? this->size_and_flags | prev_free_bit : this->size_and_flags & ~prev_free_bit;
+        }
+
+        [[nodiscard]] std::byte *payload() noexcept { return reinterpret_cast<std::byte *>(&this->next_free); }
+        static Block *from_payload(void *payload) noexcept {
+            return reinterpret_cast<Block *>(static_cast<std::byte *>(payload) - payload_offset);
+        }
+
+        [[nodiscard]] Block *next() noexcept {
+            return reinterpret_cast<Block *>(this->payload() + this->size() - sizeof(Block *));
+        }
+        [[nodiscard]] const Block *next() const noexcept { return const_cast<Block *>(this)->next(); }
+        Block *link_next() noexcept {
+            Block *next = this->next();
+            next->prev_physical = this;
+            return next;
+        }
+    };
+
+    static constexpr size_t payload_offset = sizeof(Block *) + header_overhead;
+    static_assert(offsetof(Block, next_free) == payload_offset);
+
+    // a free block holds its two list links and the next block's prev_physical
+    static constexpr size_t block_size_min = (3 * sizeof(Block *) + alignment - 1) & ~(alignment - 1);
+    static constexpr size_t block_size_max = size_t{1} << fl_index_max;
+    // smallest leading free block split off for an over-aligned allocation
+    static constexpr size_t gap_min = header_overhead + block_size_min;
+
+    static_assert(fl_index_count <= std::numeric_limits<std::uint32_t>::digits);
+    static_assert(sl_index_count <= std::numeric_limits<std::uint32_t>::digits);
+
+    struct Mapping {
+        size_t fl;
+        size_t sl;
+    };
+
+    static constexpr std::uintptr_t align_up(std::uintptr_t value, size_t align = alignment) noexcept {
+        return (value + align - 1) & ~(static_cast<std::uintptr_t>(align) - 1);
+    }
+
+    /**
+     * @brief Returns the block size serving a request, or 0 if there is none.
+     */
+    static constexpr size_t adjust_request_size(size_t size) noexcept {
+        if (size == 0 || size >= block_size_max) {
+            return 0;
+        }
+        return std::max(static_cast<size_t>(align_up(size)), block_size_min);
+    }
+
+    /**
+     * @brief Returns the list a block of size belongs to.
+     */
+    static constexpr Mapping mapping_insert(size_t size) noexcept {
+        if (size < small_block_size) {
+            return {0, size / (small_block_size / sl_index_count)};
+        }
+        const size_t fl = std::bit_width(size) - 1;
+        const size_t sl = (size >> (fl - sl_index_count_log2)) ^ sl_index_count;
+        return {fl - (fl_index_shift - 1), sl};
+    }
+
+    /**
+     * @brief Returns the first list whose blocks are all at least size, so the
+     * head of any non-empty list from there on fits without a search.
+     */
+    static constexpr Mapping mapping_search(size_t size) noexcept {
+        if (size >= small_block_size) {
+            size += (size_t{1} << (std::bit_width(size) - 1 - sl_index_count_log2)) - 1;
+        }
+        return mapping_insert(size);
+    }
+
+    Block *search_suitable_block(Mapping &mapping) noexcept {
+        std::uint32_t sl_map = this->sl_bitmap[mapping.fl] & (~std::uint32_t{0} << mapping.sl);
+        if (!sl_map) {
+            const std::uint32_t fl_map =
+                mapping.fl + 1 < fl_index_count ? this->fl_bitmap & (~std::uint32_t{0} << (mapping.fl + 1)) : 0;
+            if (!fl_map) {
+                return nullptr;
+            }
+            mapping.fl = std::countr_zero(fl_map);
+            sl_map = this->sl_bitmap[mapping.fl];
+        }
+        mapping.sl = std::countr_zero(sl_map);
+        return this->blocks[mapping.fl][mapping.sl];
+    }
+
+    void insert_free_block(Block *block) noexcept {
+        const auto [fl, sl] = mapping_insert(block->size());
+        Block *current = this->blocks[fl][sl];
+        block->next_free = current;
+        block->prev_free = &this->null_block;
+        current->prev_free = block;
+        this->blocks[fl][sl] = block;
+        this->fl_bitmap |= std::uint32_t{1} << fl;
+        this->sl_bitmap[fl] |= std::uint32_t{1} << sl;
+    }
+
+    void remove_free_block(Block *block, Mapping mapping) noexcept {
+        const auto [fl, sl] = mapping;
+        Block *prev = block->prev_free;
+        Block *next = block->next_free;
+        next->prev_free = prev;
+        prev->next_free = next;
+        if (this->blocks[fl][sl] == block) {
+            this->blocks[fl][sl] = next;
+            if (next == &this->null_block) {
+                this->sl_bitmap[fl] &= ~(std::uint32_t{1} << sl);
+                if (!this->sl_bitmap[fl]) {
+                    this->fl_bitmap &= ~(std::uint32_t{1} << fl);
+                }
+            }
+        }
+    }
+
+    void remove_free_block(Block *block) noexcept { this->remove_free_block(block, mapping_insert(block->size())); }
+
+    [[nodiscard]] bool is_listed(const Block *block) const noexcept {
+        const auto [fl, sl] = mapping_insert(block->size());
+        for (const Block *free = this->blocks[fl][sl]; free != &this->null_block; free = free->next_free) {
+            if (free == block) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Take a free block of at least size bytes off its list.
+     */
+    Block *locate_free(size_t size) noexcept {
+        if (!size) {
+            return nullptr;
+        }
+        Mapping mapping = mapping_search(size);
+        if (mapping.fl >= fl_index_count) {
+            return nullptr;
+        }
+        Block *block = this->search_suitable_block(mapping);
+        if (!block) {
+            return nullptr;
+        }
+        this->remove_free_block(block, mapping);
+        return block;
+    }
+
+    static void mark_as_free(Block *block) noexcept {
+        block->link_next()->set_prev_free(true);
+        block->set_free(true);
+    }
+
+    static void mark_as_used(Block *block) noexcept {
+        block->next()->set_prev_free(false);
+        block->set_free(false);
+    }
+
+    /**
+     * @brief Split a free block after size payload bytes.
+     *
+     * @return The free remainder, not on any list.
+     */
+    static Block *split(Block *block, size_t size) noexcept {
+        Block *remaining = reinterpret_cast<Block *>(block->payload() + size - sizeof(Block *));
+        remaining->size_and_flags = block->size() - (size + header_overhead);
+        block->set_size(size);
+        mark_as_free(remaining);
+        return remaining;
+    }
+
+    static bool can_split(const Block *block, size_t size) noexcept {
+        return block->size() >= size + header_overhead + block_size_min;
+    }
+
+    /**
+     * @brief Return the tail of a free block beyond size bytes to the free
+     * lists.
+     */
+    void trim_free(Block *block, size_t size) noexcept {
+        if (can_split(block, size)) {
+            Block *remaining = this->split(block, size);
+            block->link_next();
+            remaining->set_prev_free(true);
+            this->insert_free_block(remaining);
+        }
+    }
+
+    /**
+     * @brief Return the first gap bytes of a free block to the free lists.
+     *
+     * @return The rest of the block, starting gap bytes later.
+     */
+    Block *trim_free_leading(Block *block, size_t gap) noexcept {
+        Block *remaining = this->split(block, gap - header_overhead);
+        remaining->set_prev_free(true);
+        block->link_next();
+        this->insert_free_block(block);
+        return remaining;
+    }
+
+    void *prepare_used(Block *block, size_t size) noexcept {
+        this->trim_free(block, size);
+        mark_as_used(block);
+        this->used += block->size() + header_overhead;
+        this->min_ever_free = std::min(this->min_ever_free, this->get_free_size());
+        ++this->allocations;
+        return block->payload();
+    }
+
+    static Block *absorb(Block *prev, Block *block) noexcept {
+        prev->size_and_flags += block->size() + header_overhead;
+        prev->link_next();
+        return prev;
+    }
+
+    Block *merge_prev(Block *block) noexcept {
+        if (block->is_prev_free()) {
+            Block *prev = block->prev_physical;
+            this->remove_free_block(prev);
+            block = absorb(prev, block);
+        }
+        return block;
+    }
+
+    Block *merge_next(Block *block) noexcept {
+        Block *next = block->next();
+        if (next->is_free()) {
+            this->remove_free_block(next);
+            block = absorb(block, next);
+        }
+        return block;
+    }
+
+    Block null_block{};
+    std::uint32_t fl_bitmap = 0;
+    std::array<std::uint32_t, fl_index_count> sl_bitmap{};
+    std::array<std::array<Block *, sl_index_count>, fl_index_count> blocks{};
+    Block *first_block = nullptr;
+    size_t total = 0;
+    size_t used = 0;
+    size_t min_ever_free = 0;
+    size_t allocations = 0;
+    size_t frees = 0;
+};
+
+/**
+ * @brief Owning TLSF allocator over N bytes.
+ */
+template <size_t N> class StaticTlsf : public Tlsf {
+public:
+    StaticTlsf() noexcept : Tlsf{buffer} {}
+
+private:
+    alignas(Tlsf::alignment) std::array<std::byte, N> buffer;
+};
+
+/**
+ * @brief std::pmr::memory_resource adapter over a Tlsf, e.g. for
+ * std::pmr::vector or std::pmr::string.
+ *
+ * Exhaustion throws std::bad_alloc, or panics when built without exceptions.
+ *
+ * @note Not thread-safe, like the underlying Tlsf.
+ */
+class TlsfResource : public std::pmr::memory_resource {
+public:
+    explicit TlsfResource(Tlsf &tlsf) noexcept : tlsf(tlsf) {}
+
+private:
+    void *do_allocate(size_t bytes, size_t alignment) override {
+        void *pointer = this->tlsf.allocate(std::max<size_t>(bytes, 1), alignment);
+        if (!pointer) {
+#if __cpp_exceptions
+            throw std::bad_alloc{};
+#else
+            LN_PANIC();
+#endif
+        }
+        return pointer;
+    }
+
+    void do_deallocate(void *pointer, size_t /*bytes*/, size_t /*alignment*/) override {
+        this->tlsf.deallocate(pointer);
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+    Tlsf &tlsf;
+};
+
+} // namespace ln
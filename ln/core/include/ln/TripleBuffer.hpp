@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/cache.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace ln {
+
+/**
+ * @brief Wait-free single-writer/single-reader exchange of the latest value.
+ *
+ * Three copies of T: the writer fills its back buffer and publishes it by
+ * swapping it with the middle one; the reader swaps the middle one with its
+ * front buffer when a newer value is there. Each swap is one atomic exchange,
+ * so neither side ever waits or retries, whatever their priorities, and
+ * readers always see a complete value. Values published before the reader
+ * catches up are skipped.
+ *
+ * Unlike SeqLock, T need not be trivially copyable, and the writer fills the
+ * buffer in place instead of copying a value in.
+ *
+ * @code
+ * // writer
+ * Frame &frame = buffer.write_buffer();
+ * sensor.read_into(frame);
+ * buffer.publish();
+ *
+ * // reader
+ * if (buffer.update()) {
+ *     process(buffer.read_buffer());
+ * }
+ * @endcode
+ */
+template <typename T> class TripleBuffer {
+public:
+    TripleBuffer() noexcept = default;
+
+    /**
+     * @brief Start with initial in all three buffers, so the reader sees it
+     * until the first publish().
+     */
+    explicit TripleBuffer(const T &initial) noexcept {
+        for (Slot &slot : this->slots) {
+            slot.value = initial;
+        }
+    }
+
+    TripleBuffer(const TripleBuffer &) = delete;
+    TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+    /**
+     * @brief Returns the buffer the writer fills before publish(). Writer
+     * only. Holds a stale value, not the last one published.
+     */
+    [[nodiscard]] T &write_buffer() noexcept { return this->slots[this->back].value; }
+
+    /**
+     * @brief Make the write buffer the latest value and take a fresh one.
+     * Writer only.
+     */
+    void publish() noexcept {
+        const std::uint8_t previous = this->middle.exchange(this->back | fresh, std::memory_order_acq_rel);
+        this->back = previous & index_mask;
+    }
+
+    /**
+     * @brief Copy value into the write buffer and publish it. Writer only.
+     */
+    void write(const T &value) noexcept {
+        this->write_buffer() = value;
+        this->publish();
+    }
+
+    /**
+     * @brief Switch the read buffer to the latest published value, if there
+     * is a newer one. Reader only.
+     *
+     * @return true if the read buffer changed.
+     */
+    bool update() noexcept {
+        if (!(this->middle.load(std::memory_order_relaxed) & fresh)) {
+            return false;
+        }
+        const std::uint8_t previous = this->middle.exchange(this->front, std::memory_order_acq_rel);
+        this->front = previous & index_mask;
+        return true;
+    }
+
+    /**
+     * @brief Returns the value the reader holds; stable until the next
+     * update(). Reader only.
+     */
+    [[nodiscard]] const T &read_buffer() const noexcept { return this->slots[this->front].value; }
+
+    /**
+     * @brief update() and return the latest value. Reader only.
+     */
+    [[nodiscard]] const T &read() noexcept {
+        (void)this->update();
+        return this->read_buffer();
+    }
+
+    /**
+     * @brief Returns true if a value was published since the last update().
+     */
+    [[nodiscard]] bool has_update() const noexcept { return this->middle.load(std::memory_order_relaxed) & fresh; }
+
+private:
+    static constexpr std::uint8_t index_mask = 0b011;
+    static constexpr std::uint8_t fresh = 0b100; ///< middle holds a value the reader has not taken
+
+    struct Slot {
+        alignas(cache_line_size) T value{};
+    };
+
+    std::array<Slot, 3> slots{};
+    alignas(cache_line_size) std::atomic<std::uint8_t> middle{1};
+    alignas(cache_line_size) std::uint8_t back = 0;  ///< writer's
+    alignas(cache_line_size) std::uint8_t front = 2; ///< reader's
+};
+
+} // namespace ln
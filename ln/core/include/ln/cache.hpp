@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Data cache line size in bytes. Cortex-M7 uses 32-byte lines, most host
+ * CPUs use 64-byte lines. Override by defining LN_CACHE_LINE_SIZE.
+ */
+#ifndef LN_CACHE_LINE_SIZE
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+#define LN_CACHE_LINE_SIZE 32
+#else
+#define LN_CACHE_LINE_SIZE 64
+#endif
+#endif
+
+namespace ln {
+
+/**
+ * @brief Alignment that keeps independently written data on separate cache
+ * lines to avoid false sharing.
+ *
+ * @note std::hardware_destructive_interference_size is not used on purpose: its
+ * value is ABI-unstable and GCC warns about using it in headers.
+ */
+inline constexpr std::size_t cache_line_size = LN_CACHE_LINE_SIZE;
+
+} // namespace ln
@@ -0,0 +1,516 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/Pool.hpp"
+#include "ln/StaticForwardList.hpp"
+#include "ln/ln.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+/**
+ * @brief Stackless cooperative jobs, many of which share one task.
+ *
+ * A job is a coroutine returning ln::co::Job whose first parameter is the
+ * Scheduler that runs it, followed by at most 8 more. Its frame comes from
+ * the scheduler's fixed frame pool, never from the heap. Between co_await
+ * points a job runs on the stack of the scheduler's task, so a periodic job
+ * costs a frame of a few dozen bytes instead of a task with its own stack:
+ *
+ * @code
+ * ln::co::Job blink(ln::co::Scheduler &scheduler, Led &led) {
+ *     auto next = scheduler.now();
+ *     while (true) {
+ *         led.toggle();
+ *         next += 500ms;
+ *         co_await ln::co::sleep_until(next);
+ *     }
+ * }
+ *
+ * scheduler.spawn(blink(scheduler, led));
+ * @endcode
+ */
+namespace ln::co {
+
+class Scheduler;
+
+namespace detail {
+/**
+ * @brief Stands in for any job parameter after the scheduler, so the frame
+ * operator new need not be a template and pairs with the plain operator
+ * delete, which GCC checks with -Wmismatched-new-delete.
+ */
+struct AnyJobArg {
+    constexpr AnyJobArg() noexcept = default;
+    template <typename T> constexpr AnyJobArg(const T & /*arg*/) noexcept {}
+};
+} // namespace detail
+
+/**
+ * @brief Handle to a job that has not been spawned yet.
+ */
+class [[nodiscard]] Job {
+public:
+    struct promise_type : StaticForwardListNode<promise_type> {
+        static constexpr size_t max_job_args = 8;
+
+        template <typename... Args>
+        explicit promise_type(Scheduler &scheduler, Args &.../*args*/) noexcept : scheduler(&scheduler) {
+            static_assert(sizeof...(Args) <= max_job_args,
+                          "ln::co::Job takes at most 8 parameters after the Scheduler, group the rest in a struct");
+        }
+
+        // one detail::AnyJobArg per job parameter, see max_job_args
+        static void *operator new(size_t size, Scheduler &scheduler, detail::AnyJobArg = {}, detail::AnyJobArg = {},
+                                  detail::AnyJobArg = {}, detail::AnyJobArg = {}, detail::AnyJobArg = {},
+                                  detail::AnyJobArg = {}, detail::AnyJobArg = {}, detail::AnyJobArg = {}) noexcept;
+        static void operator delete(void *frame) noexcept;
+
+        static Job get_return_object_on_allocation_failure() noexcept { return Job{}; }
+        Job get_return_object() noexcept { return Job{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept;
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { LN_PANIC(); }
+
+        Scheduler *scheduler;
+        std::uint32_t wake_at = 0;                 ///< while sleeping
+        bool (*is_ready)(void *context) = nullptr; ///< while waiting
+        void *context = nullptr;                   ///< while waiting
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Job() noexcept = default;
+    explicit Job(Handle handle) noexcept : handle(handle) {}
+
+    Job(Job &&other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    Job &operator=(Job &&other) noexcept {
+        if (this != &other) {
+            this->reset();
+            this->handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+
+    Job(const Job &) = delete;
+    Job &operator=(const Job &) = delete;
+
+    ~Job() { this->reset(); }
+
+    /**
+     * @brief Returns false if the frame pool could not fit the job.
+     */
+    explicit operator bool() const noexcept { return static_cast<bool>(this->handle); }
+
+private:
+    friend class Scheduler;
+
+    void reset() noexcept {
+        if (this->handle) {
+            this->handle.destroy();
+            this->handle = nullptr;
+        }
+    }
+
+    Handle handle{};
+};
+
+using Promise = Job::promise_type;
+
+/**
+ * @brief Runs jobs cooperatively on one thread of execution.
+ *
+ * Jobs are resumed in FIFO order by run_once(). A job that co_awaits is
+ * parked in one of three intrusive lists: ready (yield), sleeping (sorted by
+ * wake time) or waiting (a condition polled on every run_once()). Waiting
+ * jobs are re-checked whenever the scheduler wakes, so whoever makes a
+ * condition true, e.g. an ISR pushing into a ring buffer, must call notify().
+ *
+ * Time is kept in milliseconds as a wrapping 32-bit counter, so sleeps must
+ * be shorter than about 24 days.
+ *
+ * Derived classes provide the clock and the blocking, see
+ * ln::drivers::CoroutineTask for a FreeRTOS task.
+ *
+ * @note spawn() and run_once() must be called from the scheduler's own
+ * context (or before it runs). notify() is safe from any context.
+ */
+class Scheduler {
+public:
+    using Duration = std::chrono::duration<std::uint32_t, std::milli>;
+
+    /// ll_wait() timeout meaning no timeout
+    static constexpr std::uint32_t forever = std::numeric_limits<std::uint32_t>::max();
+
+    /// bytes in front of every frame pointing back to its pool
+    static constexpr size_t frame_overhead = alignof(std::max_align_t);
+
+    explicit Scheduler(BlockPool &frames) noexcept : frames(frames) {}
+
+    Scheduler(const Scheduler &) = delete;
+    Scheduler &operator=(const Scheduler &) = delete;
+    virtual ~Scheduler() = default;
+
+    /**
+     * @brief Hand job over to the scheduler; it first runs on the next
+     * run_once().
+     *
+     * @return false if the job's frame could not be allocated.
+     */
+    bool spawn(Job &&job) noexcept {
+        if (!job) {
+            return false;
+        }
+        Promise &promise = std::exchange(job.handle, nullptr).promise();
+        ++this->job_count;
+        this->make_ready(promise);
+        return true;
+    }
+
+    /**
+     * @brief Wake the scheduler to re-check waiting jobs. Safe from any
+     * context.
+     */
+    void notify() noexcept { this->ll_notify(); }
+
+    /**
+     * @brief Wake due sleepers and satisfied waiters, then resume every job
+     * that was ready at the start of the call once.
+     *
+     * @return Number of jobs resumed.
+     */
+    size_t run_once() noexcept {
+        const std::uint32_t now = this->ll_now();
+        while (this->sleeping && !is_before(now, promise_of(this->sleeping).wake_at)) {
+            Node *node = std::exchange(this->sleeping, this->sleeping->next);
+            this->make_ready(promise_of(node));
+        }
+        for (Node **link = &this->waiting; *link;) {
+            Promise &promise = promise_of(*link);
+            if (promise.is_ready(promise.context)) {
+                *link = promise.next;
+                this->make_ready(promise);
+            }
+            else {
+                link = &promise.next;
+            }
+        }
+
+        // jobs made ready while resuming run on the next call
+        Node *runnable = std::exchange(this->ready_head, nullptr);
+        this->ready_tail = nullptr;
+        size_t resumed = 0;
+        while (runnable) {
+            Promise &promise = promise_of(std::exchange(runnable, runnable->next));
+            Job::Handle::from_promise(promise).resume();
+            ++resumed;
+        }
+        return resumed;
+    }
+
+    /**
+     * @brief Returns how long the scheduler may block before run_once() has
+     * work: 0 if jobs are ready, forever if nothing is sleeping.
+     */
+    [[nodiscard]] std::uint32_t get_wait_timeout() noexcept {
+        if (this->ready_head) {
+            return 0;
+        }
+        if (!this->sleeping) {
+            return forever;
+        }
+        const std::uint32_t now = this->ll_now();
+        const std::uint32_t wake_at = promise_of(this->sleeping).wake_at;
+        return is_before(now, wake_at) ? wake_at - now : 0;
+    }
+
+    /**
+     * @brief Run jobs forever, blocking in ll_wait() while there is nothing
+     * to do.
+     */
+    [[noreturn]] void run() noexcept {
+        while (true) {
+            (void)this->run_once();
+            this->ll_wait(this->get_wait_timeout());
+        }
+    }
+
+    [[nodiscard]] Duration now() noexcept { return Duration{this->ll_now()}; }
+
+    /**
+     * @brief Returns the number of spawned jobs that have not finished.
+     */
+    [[nodiscard]] size_t get_job_count() const noexcept { return this->job_count; }
+
+    [[nodiscard]] BlockPool::Usage get_frame_usage() const noexcept { return this->frames.get_usage(); }
+
+protected:
+    /**
+     * @brief Returns a free-running millisecond counter.
+     */
+    virtual std::uint32_t ll_now() = 0;
+
+    /**
+     * @brief Block until ll_notify() is called or timeout_ms elapses (never
+     * if forever). A notification given while not blocked must not be lost.
+     */
+    virtual void ll_wait(std::uint32_t timeout_ms) = 0;
+
+    /**
+     * @brief Wake ll_wait(). Called in any context.
+     */
+    virtual void ll_notify() = 0;
+
+private:
+    friend struct Job::promise_type;
+    friend class SleepAwaiter;
+    friend class YieldAwaiter;
+    template <typename Predicate> friend class WaitAwaiter;
+
+    using Node = StaticForwardListNode<Promise>;
+
+    static Promise &promise_of(Node *node) noexcept { return static_cast<Promise &>(*node); }
+
+    static bool is_before(std::uint32_t a, std::uint32_t b) noexcept {
+        return static_cast<std::int32_t>(a - b) < 0;
+    }
+
+    void make_ready(Promise &promise) noexcept {
+        promise.next = nullptr;
+        if (this->ready_tail) {
+            this->ready_tail->next = &promise;
+        }
+        else {
+            this->ready_head = &promise;
+        }
+        this->ready_tail = &promise;
+    }
+
+    void make_sleeping(Promise &promise, std::uint32_t wake_at) noexcept {
+        promise.wake_at = wake_at;
+        Node **link = &this->sleeping;
+        // sleepers with the same wake time keep their order
+        while (*link && !is_before(wake_at, promise_of(*link).wake_at)) {
+            link = &(*link)->next;
+        }
+        promise.next = *link;
+        *link = &promise;
+    }
+
+    void make_waiting(Promise &promise, bool (*is_ready)(void *), void *context) noexcept {
+        promise.is_ready = is_ready;
+        promise.context = context;
+        promise.next = this->waiting;
+        this->waiting = &promise;
+    }
+
+    void *allocate_frame(size_t size) noexcept {
+        if (size + frame_overhead > this->frames.get_block_size()) {
+            return nullptr;
+        }
+        void *block = this->frames.allocate();
+        if (!block) {
+            return nullptr;
+        }
+        *static_cast<BlockPool **>(block) = &this->frames;
+        return static_cast<std::byte *>(block) + frame_overhead;
+    }
+
+    static void deallocate_frame(void *frame) noexcept {
+        void *block = static_cast<std::byte *>(frame) - frame_overhead;
+        (*static_cast<BlockPool **>(block))->deallocate(block);
+    }
+
+    BlockPool &frames;
+    Node *ready_head = nullptr;
+    Node *ready_tail = nullptr;
+    Node *sleeping = nullptr; ///< sorted by wake time
+    Node *waiting = nullptr;
+    size_t job_count = 0;
+};
+
+/**
+ * @brief Frame pool for N jobs with frames of up to frame_size bytes.
+ */
+template <size_t frame_size, size_t N> class FramePool : public BlockPool {
+    static_assert(N > 0 && N <= BlockPool::max_block_count, "FramePool capacity N out of range");
+
+public:
+    FramePool() noexcept : BlockPool{buffer, block_size, alignof(std::max_align_t)} {}
+
+private:
+    static constexpr size_t block_size = frame_size + Scheduler::frame_overhead;
+    alignas(std::max_align_t) std::array<std::byte, BlockPool::get_stride(block_size, alignof(std::max_align_t)) * N>
+        buffer;
+};
+
+inline void *Job::promise_type::operator new(size_t size, Scheduler &scheduler, detail::AnyJobArg, detail::AnyJobArg,
+                                            detail::AnyJobArg, detail::AnyJobArg, detail::AnyJobArg, detail::AnyJobArg,
+                                            detail::AnyJobArg, detail::AnyJobArg) noexcept {
+    return scheduler.allocate_frame(size);
+}
+
+inline void Job::promise_type::operator delete(void *frame) noexcept { Scheduler::deallocate_frame(frame); }
+
+inline std::suspend_never Job::promise_type::final_suspend() noexcept {
+    --this->scheduler->job_count;
+    return {};
+}
+
+class SleepAwaiter {
+public:
+    explicit SleepAwaiter(std::uint32_t wake_at, bool relative) noexcept : wake_at(wake_at), relative(relative) {}
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Job::Handle handle) const noexcept {
+        Scheduler &scheduler = *handle.promise().scheduler;
+        scheduler.make_sleeping(handle.promise(), this->relative ? scheduler.ll_now() + this->wake_at : this->wake_at);
+    }
+    void await_resume() const noexcept {}
+
+private:
+    std::uint32_t wake_at;
+    bool relative;
+};
+
+class YieldAwaiter {
+public:
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Job::Handle handle) const noexcept { handle.promise().scheduler->make_ready(handle.promise()); }
+    void await_resume() const noexcept {}
+};
+
+template <typename Predicate> class WaitAwaiter {
+public:
+    explicit WaitAwaiter(Predicate predicate) noexcept : predicate(std::move(predicate)) {}
+
+    bool await_ready() noexcept { return this->predicate(); }
+    void await_suspend(Job::Handle handle) noexcept {
+        handle.promise().scheduler->make_waiting(
+            handle.promise(), [](void *context) { return (*static_cast<Predicate *>(context))(); }, &this->predicate);
+    }
+    void await_resume() const noexcept {}
+
+private:
+    Predicate predicate;
+};
+
+/**
+ * @brief Suspend the job for at least duration.
+ */
+template <typename Rep, typename Period> SleepAwaiter sleep_for(std::chrono::duration<Rep, Period> duration) noexcept {
+    return SleepAwaiter{std::chrono::ceil<Scheduler::Duration>(duration).count(), true};
+}
+
+/**
+ * @brief Suspend the job until the scheduler clock reaches time, see
+ * Scheduler::now(). Unlike repeated sleep_for() calls, does not drift.
+ */
+inline SleepAwaiter sleep_until(Scheduler::Duration time) noexcept { return SleepAwaiter{time.count(), false}; }
+
+/**
+ * @brief Let the other ready jobs run first.
+ */
+inline YieldAwaiter yield() noexcept { return {}; }
+
+/**
+ * @brief Suspend the job until predicate() returns true. The predicate is
+ * polled each time the scheduler wakes, see Scheduler::notify().
+ */
+template <typename Predicate> WaitAwaiter<Predicate> wait_until(Predicate predicate) noexcept {
+    return WaitAwaiter<Predicate>{std::move(predicate)};
+}
+
+/**
+ * @brief Suspend the job until buffer has elements to read, e.g. an
+ * SpscRingBufferView filled from an ISR that calls Scheduler::notify().
+ */
+template <typename Buffer> auto wait_readable(const Buffer &buffer) noexcept {
+    return wait_until([&buffer] { return !buffer.empty(); });
+}
+
+/**
+ * @brief Suspend the job until buffer has room for another element.
+ */
+template <typename Buffer> auto wait_writable(const Buffer &buffer) noexcept {
+    return wait_until([&buffer] { return !buffer.full(); });
+}
+
+/**
+ * @brief Counting semaphore jobs can co_await. give() is safe from any
+ * context, including ISRs.
+ */
+class Semaphore {
+public:
+    explicit Semaphore(Scheduler &scheduler, std::uint32_t initial_count = 0,
+                       std::uint32_t max_count = std::numeric_limits<std::uint32_t>::max()) noexcept
+        : scheduler(scheduler), count(initial_count), max_count(max_count) {}
+
+    Semaphore(const Semaphore &) = delete;
+    Semaphore &operator=(const Semaphore &) = delete;
+
+    /**
+     * @brief Release one unit and wake the scheduler.
+     *
+     * @return false if the count is already at max_count.
+     */
+    bool give() noexcept {
+        std::uint32_t observed = this->count.load(std::memory_order_relaxed);
+        do {
+            if (observed == this->max_count) {
+                return false;
+            }
+        } while (!this->count.compare_exchange_weak(observed, observed + 1, std::memory_order_release,
+                                                    std::memory_order_relaxed));
+        this->scheduler.notify();
+        return true;
+    }
+
+    /**
+     * @brief Take one unit without waiting.
+     *
+     * @return false if none is available.
+     */
+    bool try_take() noexcept {
+        std::uint32_t observed = this->count.load(std::memory_order_relaxed);
+        do {
+            if (observed == 0) {
+                return false;
+            }
+        } while (!this->count.compare_exchange_weak(observed, observed - 1, std::memory_order_acquire,
+                                                    std::memory_order_relaxed));
+        return true;
+    }
+
+    /**
+     * @brief co_await to take one unit, suspending until one is given.
+     */
+    auto take() noexcept {
+        return wait_until([this] { return this->try_take(); });
+    }
+
+    [[nodiscard]] std::uint32_t get_count() const noexcept { return this->count.load(std::memory_order_relaxed); }
+
+private:
+    Scheduler &scheduler;
+    std::atomic<std::uint32_t> count;
+    std::uint32_t max_count;
+};
+
+} // namespace ln::co
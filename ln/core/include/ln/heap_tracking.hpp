@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/HeapTracker.hpp"
+
+#include <cstddef>
+#include <span>
+
+/**
+ * @brief Process-wide heap tracking, provided by the ln::heap_tracking
+ * library (LN_HEAP_TRACKING=ON links it into ln).
+ *
+ * Linking the library replaces the global operator new/delete and, in
+ * FreeRTOS builds, wraps pvPortMalloc/vPortFree at link time, so every
+ * allocation is attributed to its call site. The functions below take
+ * consistent snapshots and are safe to call from any task.
+ */
+namespace ln::heap_tracking {
+
+[[nodiscard]] HeapTracker::Totals get_totals() noexcept;
+
+/**
+ * @brief Copy the top call sites into out, see HeapTracker::get_top_sites().
+ *
+ * @return Number of sites copied.
+ */
+size_t get_top_sites(std::span<HeapTracker::Site> out,
+                     HeapTracker::Order order = HeapTracker::Order::live_size) noexcept;
+
+void reset_peaks() noexcept;
+
+/**
+ * @brief Tracked realloc for C allocator hooks, e.g. a lua_Alloc, whose
+ * allocations are all attributed to caller.
+ *
+ * new_size 0 frees pointer and returns nullptr. old_size is the size pointer
+ * was allocated with, 0 for nullptr. Shrinking is done in place and never
+ * fails. On failure nullptr is returned and pointer is left allocated.
+ */
+void *reallocate(void *pointer, size_t old_size, size_t new_size, const void *caller) noexcept;
+
+} // namespace ln::heap_tracking
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/ln.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace ln {
+
+/**
+ * @brief Vector with a fixed capacity of N elements stored inline, modelled
+ * after C++26 std::inplace_vector. Never allocates and never throws.
+ *
+ * Where the standard throws on overflow, push_back(), emplace_back() and
+ * resize() panic instead; the try_ variants report overflow to the caller.
+ * Elements are constructed on insertion and destroyed on removal, so T does
+ * not need to be default constructible.
+ */
+template <typename T, size_t N> class inplace_vector {
+    static_assert(N > 0, "inplace_vector capacity N must be positive");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using iterator = T *;
+    using const_iterator = const T *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    inplace_vector() noexcept = default;
+
+    inplace_vector(std::initializer_list<T> values) noexcept {
+        LN_ASSERT_PANIC(values.size() <= N);
+        for (const T &value : values) {
+            this->unchecked_emplace_back(value);
+        }
+    }
+
+    explicit inplace_vector(std::span<const T> values) noexcept {
+        LN_ASSERT_PANIC(values.size() <= N);
+        for (const T &value : values) {
+            this->unchecked_emplace_back(value);
+        }
+    }
+
+    inplace_vector(const inplace_vector &other) noexcept {
+        for (const T &value : other) {
+            this->unchecked_emplace_back(value);
+        }
+    }
+
+    inplace_vector(inplace_vector &&other) noexcept {
+        for (T &value : other) {
+            this->unchecked_emplace_back(std::move(value));
+        }
+        other.clear();
+    }
+
+    inplace_vector &operator=(const inplace_vector &other) noexcept {
+        if (this != &other) {
+            this->clear();
+            for (const T &value : other) {
+                this->unchecked_emplace_back(value);
+            }
+        }
+        return *this;
+    }
+
+    inplace_vector &operator=(inplace_vector &&other) noexcept {
+        if (this != &other) {
+            this->clear();
+            for (T &value : other) {
+                this->unchecked_emplace_back(std::move(value));
+            }
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~inplace_vector() { this->clear(); }
+
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return N; }
+    [[nodiscard]] static constexpr size_t max_size() noexcept { return N; }
+    [[nodiscard]] size_t size() const noexcept { return this->count; }
+    [[nodiscard]] bool empty() const noexcept { return this->count == 0; }
+    [[nodiscard]] bool full() const noexcept { return this->count == N; }
+
+    [[nodiscard]] T *data() noexcept { return reinterpret_cast<T *>(this->bytes); }
+    [[nodiscard]] const T *data() const noexcept { return reinterpret_cast<const T *>(this->bytes); }
+
+    [[nodiscard]] iterator begin() noexcept { return this->data(); }
+    [[nodiscard]] iterator end() noexcept { return this->data() + this->count; }
+    [[nodiscard]] const_iterator begin() const noexcept { return this->data(); }
+    [[nodiscard]] const_iterator end() const noexcept { return this->data() + this->count; }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return this->begin(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return this->end(); }
+    [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator{this->end()}; }
+    [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator{this->begin()}; }
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{this->end()}; }
+    [[nodiscard]] const_reverse_iterator rend() const noexcept { return const_reverse_iterator{this->begin()}; }
+
+    [[nodiscard]] T &operator[](size_t index) noexcept { return this->data()[index]; }
+    [[nodiscard]] const T &operator[](size_t index) const noexcept { return this->data()[index]; }
+    [[nodiscard]] T &front() noexcept { return this->data()[0]; }
+    [[nodiscard]] const T &front() const noexcept { return this->data()[0]; }
+    [[nodiscard]] T &back() noexcept { return this->data()[this->count - 1]; }
+    [[nodiscard]] const T &back() const noexcept { return this->data()[this->count - 1]; }
+
+    /**
+     * @brief Returns the elements as a span.
+     */
+    [[nodiscard]] std::span<T> span() noexcept { return {this->data(), this->count}; }
+    [[nodiscard]] std::span<const T> span() const noexcept { return {this->data(), this->count}; }
+    operator std::span<T>() noexcept { return this->span(); }
+    operator std::span<const T>() const noexcept { return this->span(); }
+
+    /**
+     * @brief Construct an element at the end.
+     *
+     * @return The new element, or nullptr if full.
+     */
+    template <typename... Args> T *try_emplace_back(Args &&...args) noexcept {
+        if (this->full()) {
+            return nullptr;
+        }
+        return &this->unchecked_emplace_back(std::forward<Args>(args)...);
+    }
+
+    T *try_push_back(const T &value) noexcept { return this->try_emplace_back(value); }
+    T *try_push_back(T &&value) noexcept { return this->try_emplace_back(std::move(value)); }
+
+    /**
+     * @brief Construct an element at the end. Panics if full.
+     */
+    template <typename... Args> T &emplace_back(Args &&...args) noexcept {
+        LN_ASSERT_PANIC(!this->full());
+        return this->unchecked_emplace_back(std::forward<Args>(args)...);
+    }
+
+    T &push_back(const T &value) noexcept { return this->emplace_back(value); }
+    T &push_back(T &&value) noexcept { return this->emplace_back(std::move(value)); }
+
+    /**
+     * @brief Append as many of values as fit.
+     *
+     * @return Number of values appended.
+     */
+    size_t try_append(std::span<const T> values) noexcept {
+        const size_t appended = std::min(values.size(), N - this->count);
+        for (const T &value : values.first(appended)) {
+            this->unchecked_emplace_back(value);
+        }
+        return appended;
+    }
+
+    /**
+     * @brief Construct an element before position, shifting the rest back.
+     *
+     * @return The new element, or end() if full.
+     */
+    template <typename... Args> iterator emplace(const_iterator position, Args &&...args) noexcept {
+        const auto index = static_cast<size_t>(position - this->begin());
+        if (this->full() || index > this->count) {
+            return this->end();
+        }
+        this->unchecked_emplace_back(std::forward<Args>(args)...);
+        std::rotate(this->begin() + index, this->end() - 1, this->end());
+        return this->begin() + index;
+    }
+
+    iterator insert(const_iterator position, const T &value) noexcept { return this->emplace(position, value); }
+    iterator insert(const_iterator position, T &&value) noexcept { return this->emplace(position, std::move(value)); }
+
+    /**
+     * @brief Remove the elements in [first, last), shifting the rest forward.
+     *
+     * @return Iterator to the element that followed the last removed one.
+     */
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        T *const begin = this->begin() + (first - this->cbegin());
+        T *const end = this->begin() + (last - this->cbegin());
+        this->truncate(static_cast<size_t>(std::move(end, this->end(), begin) - this->begin()));
+        return begin;
+    }
+
+    iterator erase(const_iterator position) noexcept { return this->erase(position, position + 1); }
+
+    void pop_back() noexcept {
+        LN_ASSERT_PANIC(!this->empty());
+        std::destroy_at(&this->back());
+        --this->count;
+    }
+
+    /**
+     * @brief Resize to count elements, value-initializing new ones. Panics if
+     * count exceeds the capacity.
+     */
+    void resize(size_t count) noexcept {
+        LN_ASSERT_PANIC(count <= N);
+        this->truncate(count);
+        while (this->count < count) {
+            this->unchecked_emplace_back();
+        }
+    }
+
+    void clear() noexcept { this->truncate(0); }
+
+    friend bool operator==(const inplace_vector &a, const inplace_vector &b) noexcept {
+        return std::ranges::equal(a, b);
+    }
+
+private:
+    template <typename... Args> T &unchecked_emplace_back(Args &&...args) noexcept {
+        T *element = std::construct_at(this->data() + this->count, std::forward<Args>(args)...);
+        ++this->count;
+        return *element;
+    }
+
+    void truncate(size_t count) noexcept {
+        if (count < this->count) {
+            std::destroy(this->begin() + count, this->end());
+            this->count = count;
+        }
+    }
+
+    alignas(T) std::byte bytes[N * sizeof(T)];
+    size_t count = 0;
+};
+
+} // namespace ln
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+
+/**
+ * @brief Statically registered counters, gauges and histograms.
+ *
+ * Define metrics with static storage duration, typically at namespace scope
+ * next to the code they instrument. Each one links itself into a process-wide
+ * registry on construction, which get_first() walks, e.g. for the shell's
+ * `metrics` command. Nothing is ever allocated or unregistered.
+ *
+ * Updates are single relaxed atomic operations on 32-bit words, lock-free on
+ * every target including Cortex-M, so they are safe from any task or ISR.
+ * Readers see each value atomically but not a snapshot across metrics.
+ *
+ * @code
+ * ln::metrics::Counter spi_timeouts{"spi.timeouts"};
+ * ln::metrics::Histogram<> spi_transfer_us{"spi.transfer_us"};
+ *
+ * spi_timeouts.add();
+ * spi_transfer_us.record(elapsed_us);
+ * @endcode
+ */
+namespace ln::metrics {
+
+class Metric {
+public:
+    enum class Kind : std::uint8_t { counter, gauge, histogram };
+
+    Metric(const Metric &) = delete;
+    Metric &operator=(const Metric &) = delete;
+
+    [[nodiscard]] const char *get_name() const noexcept { return this->name; }
+    [[nodiscard]] Kind get_kind() const noexcept { return this->kind; }
+
+    /**
+     * @brief Returns the next registered metric, see get_first().
+     */
+    [[nodiscard]] Metric *get_next() const noexcept { return this->next; }
+
+protected:
+    Metric(const char *name, Kind kind) noexcept;
+
+private:
+    const char *name;
+    Kind kind;
+    Metric *next = nullptr;
+};
+
+namespace detail {
+inline constinit std::atomic<Metric *> first_metric{nullptr};
+} // namespace detail
+
+/**
+ * @brief Returns the most recently registered metric; follow
+ * Metric::get_next() for the rest.
+ */
+[[nodiscard]] inline Metric *get_first() noexcept { return detail::first_metric.load(std::memory_order_acquire); }
+
+/**
+ * @brief Returns the metric registered under name, or nullptr.
+ */
+[[nodiscard]] inline Metric *find(std::string_view name) noexcept {
+    for (Metric *metric = get_first(); metric; metric = metric->get_next()) {
+        if (name == metric->get_name()) {
+            return metric;
+        }
+    }
+    return nullptr;
+}
+
+inline Metric::Metric(const char *name, Kind kind) noexcept : name(name), kind(kind) {
+    // lock-free push, function-local static metrics may be constructed by several tasks at once
+    this->next = detail::first_metric.load(std::memory_order_relaxed);
+    while (!detail::first_metric.compare_exchange_weak(this->next, this, std::memory_order_release,
+                                                       std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief Monotonic event count. Wraps around at 2^32; consumers compute
+ * rates from differences, which survive the wrap.
+ */
+class Counter : public Metric {
+public:
+    explicit Counter(const char *name) noexcept : Metric(name, Kind::counter) {}
+
+    void add(std::uint32_t count = 1) noexcept { this->value.fetch_add(count, std::memory_order_relaxed); }
+
+    [[nodiscard]] std::uint32_t get() const noexcept { return this->value.load(std::memory_order_relaxed); }
+
+    void reset() noexcept { this->value.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::uint32_t> value{0};
+};
+
+/**
+ * @brief Current level of something, e.g. queue depth or free bytes.
+ */
+class Gauge : public Metric {
+public:
+    explicit Gauge(const char *name) noexcept : Metric(name, Kind::gauge) {}
+
+    void set(std::int32_t value) noexcept { this->value.store(value, std::memory_order_relaxed); }
+    void add(std::int32_t delta) noexcept { this->value.fetch_add(delta, std::memory_order_relaxed); }
+
+    [[nodiscard]] std::int32_t get() const noexcept { return this->value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::int32_t> value{0};
+};
+
+/**
+ * @brief Type-independent part of Histogram, through which it is read.
+ */
+class HistogramBase : public Metric {
+public:
+    struct Bucket {
+        std::uint32_t lower;  ///< smallest value counted in the bucket
+        std::uint32_t upper;  ///< largest value counted in the bucket
+        std::uint32_t count;
+    };
+
+    /**
+     * @brief Count value. Safe from any context.
+     */
+    void record(std::uint32_t value) noexcept {
+        this->buckets[this->index_of(value)].fetch_add(1, std::memory_order_relaxed);
+        this->count.fetch_add(1, std::memory_order_relaxed);
+        std::uint32_t observed = this->min.load(std::memory_order_relaxed);
+        while (value < observed && !this->min.compare_exchange_weak(observed, value, std::memory_order_relaxed)) {
+        }
+        observed = this->max.load(std::memory_order_relaxed);
+        while (value > observed && !this->max.compare_exchange_weak(observed, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    [[nodiscard]] std::uint32_t get_count() const noexcept { return this->count.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns the smallest value recorded, or 0 if none was.
+     */
+    [[nodiscard]] std::uint32_t get_min() const noexcept {
+        return this->get_count() ? this->min.load(std::memory_order_relaxed) : 0;
+    }
+
+    [[nodiscard]] std::uint32_t get_max() const noexcept { return this->max.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns a value that per_mille thousandths of the recorded values
+     * do not exceed, e.g. 500 for the median or 999 for the 99.9th
+     * percentile. Exact up to the bucket width, which is at most
+     * 1/2^precision_bits of the value, and never above get_max().
+     */
+    [[nodiscard]] std::uint32_t get_quantile(std::uint32_t per_mille) const noexcept {
+        std::uint64_t total = 0;
+        for (const auto &bucket : this->buckets) {
+            total += bucket.load(std::memory_order_relaxed);
+        }
+        if (!total) {
+            return 0;
+        }
+        const std::uint64_t rank =
+            std::max<std::uint64_t>(1, (total * std::min<std::uint32_t>(per_mille, 1000) + 999) / 1000);
+        std::uint64_t seen = 0;
+        for (size_t i = 0; i < this->buckets.size(); ++i) {
+            seen += this->buckets[i].load(std::memory_order_relaxed);
+            if (seen >= rank) {
+                return std::min(this->upper_of(i), this->get_max());
+            }
+        }
+        return this->get_max();
+    }
+
+    [[nodiscard]] size_t get_bucket_count() const noexcept { return this->buckets.size(); }
+
+    [[nodiscard]] Bucket get_bucket(size_t index) const noexcept {
+        return {this->lower_of(index), this->upper_of(index), this->buckets[index].load(std::memory_order_relaxed)};
+    }
+
+    void reset() noexcept {
+        for (auto &bucket : this->buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        this->count.store(0, std::memory_order_relaxed);
+        this->min.store(std::numeric_limits<std::uint32_t>::max(), std::memory_order_relaxed);
+        this->max.store(0, std::memory_order_relaxed);
+    }
+
+protected:
+    HistogramBase(const char *name, std::span<std::atomic<std::uint32_t>> buckets, std::uint8_t sub_bucket_bits,
+                  std::uint8_t value_bits) noexcept
+        : Metric(name, Kind::histogram), buckets(buckets), sub_bucket_bits(sub_bucket_bits), value_bits(value_bits) {}
+
+private:
+    [[nodiscard]] size_t index_of(std::uint32_t value) const noexcept {
+        if (this->value_bits < 32) {
+            value = std::min(value, (std::uint32_t{1} << this->value_bits) - 1);
+        }
+        if (value < (std::uint32_t{1} << this->sub_bucket_bits)) {
+            return value;
+        }
+        // the top sub_bucket_bits + 1 bits of value select the bucket within its power of two
+        const unsigned shift = std::bit_width(value) - 1 - this->sub_bucket_bits;
+        return (size_t{shift} << this->sub_bucket_bits) + (value >> shift);
+    }
+
+    [[nodiscard]] std::uint64_t lower_bound_of(size_t index) const noexcept {
+        if (index < (size_t{2} << this->sub_bucket_bits)) {
+            return index;
+        }
+        const size_t shift = (index >> this->sub_bucket_bits) - 1;
+        const size_t sub_bucket_count = size_t{1} << this->sub_bucket_bits;
+        const size_t mantissa = (index & (sub_bucket_count - 1)) | sub_bucket_count;
+        return std::uint64_t{mantissa} << shift;
+    }
+
+    [[nodiscard]] std::uint32_t lower_of(size_t index) const noexcept {
+        return static_cast<std::uint32_t>(this->lower_bound_of(index));
+    }
+
+    [[nodiscard]] std::uint32_t upper_of(size_t index) const noexcept {
+        if (index + 1 == this->buckets.size() && this->value_bits == 32) {
+            return std::numeric_limits<std::uint32_t>::max();
+        }
+        return static_cast<std::uint32_t>(this->lower_bound_of(index + 1) - 1);
+    }
+
+    std::span<std::atomic<std::uint32_t>> buckets;
+    std::uint8_t sub_bucket_bits; ///< Histogram precision_bits
+    std::uint8_t value_bits;      ///< Histogram range_bits
+    std::atomic<std::uint32_t> count{0};
+    std::atomic<std::uint32_t> min{std::numeric_limits<std::uint32_t>::max()};
+    std::atomic<std::uint32_t> max{0};
+};
+
+namespace detail {
+template <size_t bucket_count> struct HistogramBuckets {
+    std::array<std::atomic<std::uint32_t>, bucket_count> storage{};
+};
+} // namespace detail
+
+/**
+ * @brief Log-linear (HDR style) histogram of 32-bit values in fixed memory.
+ *
+ * Values below 2^precision_bits get a bucket each; above that every power of
+ * two is split into 2^precision_bits equal buckets, so the relative error
+ * stays under 1/2^precision_bits across the whole range. Values from
+ * 2^range_bits up share the last bucket; min and max stay exact.
+ *
+ * The defaults, 12.5% precision up to 16.7 million, take 176 buckets of 4
+ * bytes. Narrow range_bits to what the unit needs, e.g. 20 for a second in
+ * microseconds.
+ */
+template <std::uint8_t precision_bits = 3, std::uint8_t range_bits = 24>
+class Histogram : private detail::HistogramBuckets<size_t{range_bits - precision_bits + 1} << precision_bits>,
+                  public HistogramBase {
+    static_assert(precision_bits >= 1 && precision_bits < range_bits && range_bits <= 32,
+                  "Histogram needs 1 <= precision_bits < range_bits <= 32");
+
+public:
+    static constexpr size_t bucket_count = size_t{range_bits - precision_bits + 1} << precision_bits;
+
+    // the bucket storage base is constructed first, so the registered histogram is complete
+    explicit Histogram(const char *name) noexcept
+        : HistogramBase(name, this->storage, precision_bits, range_bits) {}
+};
+
+} // namespace ln::metrics
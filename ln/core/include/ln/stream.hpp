@@ -9,7 +9,11 @@
 
 #pragma once
 
+#include "ln/BufChain.hpp"
+
+#include <cstddef>
 #include <span>
+#include <type_traits>
 
 namespace ln {
 
@@ -18,6 +22,17 @@ public:
     virtual ~OutStream() = default;
     virtual void put(std::span<const T> span) = 0;
     void put(const T &value) { this->put(std::span<const T>(&value, 1)); }
+
+    /**
+     * @brief Put every segment of chain in turn, without gathering it first.
+     */
+    void put(const BufChain &chain)
+        requires std::is_same_v<T, std::byte>
+    {
+        for (std::span<const std::byte> segment : chain.segments()) {
+            this->put(segment);
+        }
+    }
 };
 
 template <typename T> class InStream {
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ * @file FreeRTOS heap implementation (pvPortMalloc/vPortFree) backed by
+ * ln::Tlsf, a drop-in replacement for heap_4.c with O(1) allocation and free.
+ *
+ * Select it with the LN_FREERTOS_HEAP_TLSF CMake option, or by setting
+ * FREERTOS_HEAP to the path of this file. Like heap_4, the heap is the
+ * configTOTAL_HEAP_SIZE bytes of ucHeap, which the application provides when
+ * configAPPLICATION_ALLOCATED_HEAP is 1, and access is serialized by suspending
+ * the scheduler, so it must not be used from interrupts.
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "ln/Tlsf.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 0)
+#error heap_tlsf.cpp requires configSUPPORT_DYNAMIC_ALLOCATION
+#endif
+
+static_assert(portBYTE_ALIGNMENT <= ln::Tlsf::alignment, "ln::Tlsf does not meet portBYTE_ALIGNMENT");
+
+#if (configAPPLICATION_ALLOCATED_HEAP == 1)
+extern "C" uint8_t ucHeap[configTOTAL_HEAP_SIZE];
+#else
+alignas(ln::Tlsf::alignment) PRIVILEGED_DATA static uint8_t ucHeap[configTOTAL_HEAP_SIZE];
+#endif
+
+namespace {
+
+alignas(ln::Tlsf) PRIVILEGED_DATA std::byte heap_storage[sizeof(ln::Tlsf)];
+PRIVILEGED_DATA ln::Tlsf *heap = nullptr;
+
+/**
+ * @brief Returns the heap, constructing it on first use: other static
+ * constructors may allocate before this translation unit is initialized.
+ * Call with the scheduler suspended.
+ */
+ln::Tlsf &get_heap() {
+    if (!heap) {
+        heap = new (heap_storage) ln::Tlsf{std::as_writable_bytes(std::span{ucHeap})};
+    }
+    return *heap;
+}
+
+} // namespace
+
+extern "C" {
+
+#if (configUSE_MALLOC_FAILED_HOOK == 1)
+extern void vApplicationMallocFailedHook(void);
+#endif
+
+void *pvPortMalloc(size_t xWantedSize) {
+    void *pvReturn = nullptr;
+    vTaskSuspendAll();
+    {
+        pvReturn = get_heap().allocate(xWantedSize);
+        traceMALLOC(pvReturn, xWantedSize);
+    }
+    (void)xTaskResumeAll();
+#if (configUSE_MALLOC_FAILED_HOOK == 1)
+    if (!pvReturn) {
+        vApplicationMallocFailedHook();
+    }
+#endif
+    return pvReturn;
+}
+
+void vPortFree(void *pv) {
+    if (!pv) {
+        return;
+    }
+    vTaskSuspendAll();
+    {
+        traceFREE(pv, ln::Tlsf::get_usable_size(pv));
+        get_heap().deallocate(pv);
+    }
+    (void)xTaskResumeAll();
+}
+
+void *pvPortCalloc(size_t xNum, size_t xSize) {
+    if (xSize != 0 && xNum > SIZE_MAX / xSize) {
+        return nullptr;
+    }
+    void *pv = pvPortMalloc(xNum * xSize);
+    if (pv) {
+        std::memset(pv, 0, xNum * xSize);
+    }
+    return pv;
+}
+
+size_t xPortGetFreeHeapSize(void) {
+    vTaskSuspendAll();
+    const size_t free_size = get_heap().get_free_size();
+    (void)xTaskResumeAll();
+    return free_size;
+}
+
+size_t xPortGetMinimumEverFreeHeapSize(void) {
+    vTaskSuspendAll();
+    const size_t min_ever_free = get_heap().get_min_ever_free_size();
+    (void)xTaskResumeAll();
+    return min_ever_free;
+}
+
+void xPortResetHeapMinimumEverFreeHeapSize(void) {
+    vTaskSuspendAll();
+    get_heap().reset_min_ever_free_size();
+    (void)xTaskResumeAll();
+}
+
+void vPortGetHeapStats(HeapStats_t *pxHeapStats) {
+    vTaskSuspendAll();
+    const auto stats = get_heap().get_stats();
+    (void)xTaskResumeAll();
+    pxHeapStats->xAvailableHeapSpaceInBytes = stats.free;
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = stats.largest_free_block;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = stats.smallest_free_block;
+    pxHeapStats->xNumberOfFreeBlocks = stats.free_block_count;
+    pxHeapStats->xMinimumEverFreeBytesRemaining = stats.min_ever_free;
+    pxHeapStats->xNumberOfSuccessfulAllocations = stats.allocation_count;
+    pxHeapStats->xNumberOfSuccessfulFrees = stats.free_count;
+}
+
+void vPortHeapResetState(void) { heap = nullptr; }
+
+} // extern "C"
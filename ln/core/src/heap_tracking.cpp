@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "ln/heap_tracking.hpp"
+#include "ln/ln.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if LN_HEAP_TRACKING_FREERTOS
+#include "FreeRTOS.h"
+#include "task.h"
+#else
+#include <mutex>
+#endif
+
+#ifndef LN_HEAP_TRACKING_SITE_COUNT
+#define LN_HEAP_TRACKING_SITE_COUNT 64
+#endif
+
+namespace {
+
+// constant-initialized: static constructors of other translation units allocate before dynamic initialization here
+constinit ln::StaticHeapTracker<LN_HEAP_TRACKING_SITE_COUNT> tracker{};
+
+#if LN_HEAP_TRACKING_FREERTOS
+// like the FreeRTOS heaps themselves, also works before the scheduler is started
+class Lock {
+public:
+    Lock() noexcept { vTaskSuspendAll(); }
+    ~Lock() { (void)xTaskResumeAll(); }
+};
+#else
+constinit std::mutex mutex{};
+
+class Lock {
+public:
+    Lock() noexcept { mutex.lock(); }
+    ~Lock() { mutex.unlock(); }
+};
+#endif
+
+void *allocate(size_t size, const void *caller) noexcept {
+    if (size > SIZE_MAX - ln::HeapTracker::overhead) {
+        return nullptr;
+    }
+    void *block = std::malloc(size + ln::HeapTracker::overhead);
+    Lock lock{};
+    return tracker.on_allocate(block, size, caller);
+}
+
+void deallocate(void *pointer) noexcept {
+    void *block = nullptr;
+    {
+        Lock lock{};
+        block = tracker.on_deallocate(pointer);
+    }
+    std::free(block);
+}
+
+void *allocate_or_fail(size_t size, const void *caller) {
+    // operator new must not return nullptr, even for zero bytes
+    void *pointer = allocate(size ? size : 1, caller);
+    if (!pointer) {
+#if __cpp_exceptions
+        throw std::bad_alloc{};
+#else
+        LN_PANIC();
+#endif
+    }
+    return pointer;
+}
+
+} // namespace
+
+namespace ln::heap_tracking {
+
+HeapTracker::Totals get_totals() noexcept {
+    Lock lock{};
+    return tracker.get_totals();
+}
+
+size_t get_top_sites(std::span<HeapTracker::Site> out, HeapTracker::Order order) noexcept {
+    Lock lock{};
+    return tracker.get_top_sites(out, order);
+}
+
+void reset_peaks() noexcept {
+    Lock lock{};
+    tracker.reset_peaks();
+}
+
+void *reallocate(void *pointer, size_t old_size, size_t new_size, const void *caller) noexcept {
+    if (new_size == 0) {
+        deallocate(pointer);
+        return nullptr;
+    }
+    if (pointer && new_size <= old_size) {
+        // in place, so a shrink never fails (Lua 5.3 and older rely on that)
+        Lock lock{};
+        tracker.on_shrink(pointer, new_size);
+        return pointer;
+    }
+    void *resized = allocate(new_size, caller);
+    if (resized && pointer) {
+        std::memcpy(resized, pointer, old_size < new_size ? old_size : new_size);
+        deallocate(pointer);
+    }
+    return resized;
+}
+
+} // namespace ln::heap_tracking
+
+// The replaced operators take the caller from their own return address, hence noinline. Aligned and nothrow
+// variants are left to the standard library: the former bypass tracking consistently, the latter forward here.
+
+[[gnu::noinline]] void *operator new(size_t size) { return allocate_or_fail(size, __builtin_return_address(0)); }
+
+[[gnu::noinline]] void *operator new[](size_t size) { return allocate_or_fail(size, __builtin_return_address(0)); }
+
+void operator delete(void *pointer) noexcept { deallocate(pointer); }
+
+void operator delete[](void *pointer) noexcept { deallocate(pointer); }
+
+void operator delete(void *pointer, size_t /*size*/) noexcept { deallocate(pointer); }
+
+void operator delete[](void *pointer, size_t /*size*/) noexcept { deallocate(pointer); }
+
+#if LN_HEAP_TRACKING_FREERTOS
+
+// Linked with --wrap for these symbols: references to pvPortMalloc resolve to __wrap_pvPortMalloc, while
+// __real_pvPortMalloc is the heap implementation itself.
+extern "C" {
+
+void *__real_pvPortMalloc(size_t xWantedSize);
+void __real_vPortFree(void *pv);
+
+[[gnu::noinline]] void *__wrap_pvPortMalloc(size_t xWantedSize) {
+    if (xWantedSize == 0 || xWantedSize > SIZE_MAX - ln::HeapTracker::overhead) {
+        return nullptr;
+    }
+    void *block = __real_pvPortMalloc(xWantedSize + ln::HeapTracker::overhead);
+    Lock lock{};
+    return tracker.on_allocate(block, xWantedSize, __builtin_return_address(0));
+}
+
+void __wrap_vPortFree(void *pv) {
+    void *block = nullptr;
+    {
+        Lock lock{};
+        block = tracker.on_deallocate(pv);
+    }
+    if (block) {
+        __real_vPortFree(block);
+    }
+}
+
+// the heap's own pvPortCalloc calls pvPortMalloc from within its translation unit, which --wrap does not redirect
+[[gnu::noinline]] void *__wrap_pvPortCalloc(size_t xNum, size_t xSize) {
+    if (xSize != 0 && xNum > (SIZE_MAX - ln::HeapTracker::overhead) / xSize) {
+        return nullptr;
+    }
+    const size_t size = xNum * xSize;
+    void *block = size ? __real_pvPortMalloc(size + ln::HeapTracker::overhead) : nullptr;
+    if (block) {
+        std::memset(static_cast<std::byte *>(block) + ln::HeapTracker::overhead, 0, size);
+    }
+    Lock lock{};
+    return tracker.on_allocate(block, size, __builtin_return_address(0));
+}
+
+} // extern "C"
+
+#endif
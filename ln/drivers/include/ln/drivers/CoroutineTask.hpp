@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/coroutine.hpp"
+
+#include "FreeRTOS/Kernel.hpp"
+#include "FreeRTOS/Task.hpp"
+#include "FreeRTOS/Addons/Kernel.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ln::drivers {
+
+/**
+ * @brief FreeRTOS task running ln::co jobs, with frame_count frames of
+ * frame_size bytes each.
+ *
+ * The task blocks on its task notification while no job is ready, so many
+ * small state machines can share one stack, e.g.:
+ *
+ * @code
+ * ln::co::Job blink(ln::co::Scheduler &scheduler, Led &led) {
+ *     while (true) {
+ *         led.toggle();
+ *         co_await ln::co::sleep_for(500ms);
+ *     }
+ * }
+ *
+ * static ln::drivers::CoroutineTask<256, 4> jobs{2, 256, "jobs"};
+ * jobs.spawn(blink(jobs, led));
+ * @endcode
+ *
+ * Time is kept in ticks and converted to milliseconds, so the resolution of
+ * sleeps is one tick.
+ */
+template <size_t frame_size, size_t frame_count>
+class CoroutineTask : public ln::co::Scheduler, public FreeRTOS::Task {
+public:
+    CoroutineTask(UBaseType_t priority, configSTACK_DEPTH_TYPE stack_depth, const char *name)
+        : ln::co::Scheduler(frames), FreeRTOS::Task(priority, stack_depth, name) {}
+
+    // FreeRTOS::Task::notify() sends a raw task notification
+    using ln::co::Scheduler::notify;
+
+protected:
+    std::uint32_t ll_now() override {
+        // accumulate so the tick counter wrapping does not make time jump
+        const TickType_t ticks = FreeRTOS::Kernel::getTickCount();
+        this->elapsed_ticks += static_cast<TickType_t>(ticks - this->last_ticks);
+        this->last_ticks = ticks;
+        return static_cast<std::uint32_t>(this->elapsed_ticks * 1000 / configTICK_RATE_HZ);
+    }
+
+    void ll_wait(std::uint32_t timeout_ms) override {
+        TickType_t timeout = portMAX_DELAY;
+        if (timeout_ms != forever) {
+            // round up so a sleep never ends early
+            timeout = static_cast<TickType_t>((std::uint64_t{timeout_ms} * configTICK_RATE_HZ + 999) / 1000);
+        }
+        (void)FreeRTOS::Task::notifyTake(true, timeout);
+    }
+
+    void ll_notify() override {
+        if (FreeRTOS::Addons::Kernel::isInsideInterrupt()) {
+            bool higher_priority_task_woken = false;
+            this->notifyGiveFromISR(higher_priority_task_woken);
+            // must be called last
+            FreeRTOS::Kernel::yieldFromISR(higher_priority_task_woken);
+        }
+        else {
+            this->notifyGive();
+        }
+    }
+
+private:
+    void taskFunction() final { this->run(); }
+
+    ln::co::FramePool<frame_size, frame_count> frames;
+    TickType_t last_ticks = 0;
+    std::uint64_t elapsed_ticks = 0;
+};
+
+} // namespace ln::drivers
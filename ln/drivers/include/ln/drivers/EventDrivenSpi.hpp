@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "ln/BufChain.hpp"
 #include "ln/ln.h"
 
 #include "FreeRTOS/Mutex.hpp"
@@ -40,6 +41,16 @@ public:
      */
     bool read(std::uint8_t *data, std::size_t size, const Timeout &timeout = Timeout::max());
 
+    /**
+     * @brief Read synchronously into every segment of chain, one transfer per
+     * segment, e.g. a chain from BufChain::allocate().
+     *
+     * @param chain
+     * @param timeout
+     * @return true if successful, otherwise false.
+     */
+    bool read(BufChain &chain, const Timeout &timeout = Timeout::max());
+
     /**
      * @brief Write synchronously.
      *
@@ -50,6 +61,16 @@ public:
      */
     bool write(const std::uint8_t *data, std::size_t size, const Timeout &timeout = Timeout::max());
 
+    /**
+     * @brief Write synchronously every segment of chain, one transfer per
+     * segment, without gathering it into a contiguous buffer first.
+     *
+     * @param chain
+     * @param timeout
+     * @return true if successful, otherwise false.
+     */
+    bool write(const BufChain &chain, const Timeout &timeout = Timeout::max());
+
     /**
      * @brief Write asynchronously.
      *
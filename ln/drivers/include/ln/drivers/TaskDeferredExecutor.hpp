@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/DeferredExecutor.hpp"
+#include "ln/inplace_vector.hpp"
+
+#include "FreeRTOS/Kernel.hpp"
+#include "FreeRTOS/Task.hpp"
+#include "FreeRTOS/Addons/Kernel.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ln::drivers {
+
+/**
+ * @brief ln::DeferredExecutor with one FreeRTOS task per level.
+ *
+ * Each worker task blocks on its task notification and drains its level when
+ * notified. post() gives the notification, from ISR context with
+ * notifyGiveFromISR() followed by yieldFromISR(), so a driver callback can
+ * hand its post-processing to a task instead of giving a semaphore to a
+ * dedicated one, e.g.:
+ *
+ * @code
+ * void Driver::ll_async_read_completed_cb() {
+ *     executor.post(0, [this] { this->parse_frame(); });
+ * }
+ * @endcode
+ *
+ * Latency is measured with the FreeRTOS run time stats counter if
+ * configGENERATE_RUN_TIME_STATS is enabled, otherwise in ticks.
+ */
+template <size_t level_count, size_t capacity, size_t work_size = 4 * sizeof(void *)>
+class TaskDeferredExecutor : public ln::DeferredExecutor<level_count, capacity, work_size> {
+public:
+    struct LevelConfig {
+        UBaseType_t priority;
+        configSTACK_DEPTH_TYPE stack_depth;
+        const char *name;
+    };
+
+    explicit TaskDeferredExecutor(const std::array<LevelConfig, level_count> &level_configs) {
+        for (size_t level = 0; level < level_count; ++level) {
+            this->workers.emplace_back(*this, level, level_configs[level]);
+        }
+    }
+
+protected:
+    void ll_notify(size_t level) override {
+        if (FreeRTOS::Addons::Kernel::isInsideInterrupt()) {
+            bool higher_priority_task_woken = false;
+            this->workers[level].notifyGiveFromISR(higher_priority_task_woken);
+            // must be called last
+            FreeRTOS::Kernel::yieldFromISR(higher_priority_task_woken);
+        }
+        else {
+            this->workers[level].notifyGive();
+        }
+    }
+
+    std::uint32_t ll_timestamp() override {
+#if configGENERATE_RUN_TIME_STATS
+        return static_cast<std::uint32_t>(portGET_RUN_TIME_COUNTER_VALUE());
+#else
+        return static_cast<std::uint32_t>(FreeRTOS::Addons::Kernel::isInsideInterrupt()
+                                              ? FreeRTOS::Kernel::getTickCountFromISR()
+                                              : FreeRTOS::Kernel::getTickCount());
+#endif
+    }
+
+private:
+    class Worker : public FreeRTOS::Task {
+    public:
+        Worker(TaskDeferredExecutor &executor, size_t level, const LevelConfig &config)
+            : FreeRTOS::Task(config.priority, config.stack_depth, config.name), executor(executor), level(level) {}
+
+    private:
+        void taskFunction() final {
+            while (true) {
+                // the notification count covers posts that land while draining
+                (void)FreeRTOS::Task::notifyTake(true, portMAX_DELAY);
+                (void)this->executor.run_pending(this->level);
+            }
+        }
+
+        TaskDeferredExecutor &executor;
+        size_t level;
+    };
+
+    ln::inplace_vector<Worker, level_count> workers;
+};
+
+} // namespace ln::drivers
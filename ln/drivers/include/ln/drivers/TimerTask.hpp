@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/TimerWheel.hpp"
+
+#include "FreeRTOS/Kernel.hpp"
+#include "FreeRTOS/Task.hpp"
+#include "FreeRTOS/Addons/Kernel.hpp"
+
+namespace ln::drivers {
+
+/**
+ * @brief ln::TimerWheel serviced by a FreeRTOS task.
+ *
+ * The task blocks on its task notification and advances the wheel when
+ * tick() notifies it, so timer callbacks run in this task. tick() only
+ * notifies when the wheel has work due, so the task is not switched in on
+ * idle ticks. Drive tick() from one source, e.g. the FreeRTOS tick hook for a
+ * wheel in kernel ticks:
+ *
+ * @code
+ * ln::drivers::TimerTask timers{configMAX_PRIORITIES - 1, 256, "timers"};
+ *
+ * extern "C" void vApplicationTickHook() { timers.tick(); }
+ * @endcode
+ *
+ * start() and cancel() belong to this task too; call them from timer
+ * callbacks or post them, e.g. through a DeferredExecutor.
+ */
+class TimerTask : public ln::TimerWheel, public FreeRTOS::Task {
+public:
+    TimerTask(UBaseType_t priority, configSTACK_DEPTH_TYPE stack_depth, const char *name)
+        : FreeRTOS::Task(priority, stack_depth, name) {}
+
+protected:
+    void ll_notify() override {
+        if (FreeRTOS::Addons::Kernel::isInsideInterrupt()) {
+            bool higher_priority_task_woken = false;
+            this->notifyGiveFromISR(higher_priority_task_woken);
+            // must be called last
+            FreeRTOS::Kernel::yieldFromISR(higher_priority_task_woken);
+        }
+        else {
+            this->notifyGive();
+        }
+    }
+
+private:
+    void taskFunction() final {
+        while (true) {
+            // ticks counted while running are picked up by the same call
+            (void)FreeRTOS::Task::notifyTake(true, portMAX_DELAY);
+            (void)this->run_pending();
+        }
+    }
+};
+
+} // namespace ln::drivers
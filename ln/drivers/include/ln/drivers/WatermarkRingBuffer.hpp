@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#pragma once
+
+#include "ln/FillWatermark.hpp"
+#include "ln/RingBuffer.hpp"
+
+#include "FreeRTOS/Kernel.hpp"
+#include "FreeRTOS/Semaphore.hpp"
+#include "FreeRTOS/Addons/Kernel.hpp"
+#include "FreeRTOS/Addons/Timeout.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+
+namespace ln::drivers {
+
+/**
+ * @brief Ring buffer wrapper that wakes its consumer task in batches.
+ *
+ * The producer (ISR or task) pushes elements one by one or in chunks; the
+ * consumer task blocks in read() until the fill level reaches the watermark or
+ * the timeout expires. The producer signals only when the fill level crosses
+ * the watermark, so a stream of N elements costs about N / watermark wakeups
+ * instead of N. Pick the timeout to bound the latency of a partial batch,
+ * e.g. the end of an interactive line on UART RX.
+ *
+ * Access to the wrapped ring buffer is serialized with critical sections, so
+ * it must not be used directly while wrapped. read() pops at most
+ * critical_section_chunk_size elements per critical section; push() copies
+ * all of its values in one, so keep pushed chunks short.
+ */
+template <typename T, bool power_of_two = false> class WatermarkRingBuffer {
+public:
+    using Timeout = FreeRTOS::Addons::Timeout;
+
+    /// Most elements read() copies with interrupts masked.
+    static constexpr std::size_t critical_section_chunk_size = 32;
+
+    /**
+     * @brief Construct a wrapper around ring_buffer.
+     *
+     * @param watermark Fill level that wakes the consumer, clamped to
+     * [1, capacity].
+     */
+    WatermarkRingBuffer(RingBufferView<T, power_of_two> &ring_buffer, std::size_t watermark)
+        : ring_buffer(ring_buffer), watermark(ring_buffer.capacity(), watermark) {}
+
+    /**
+     * @brief Change the fill level that wakes the consumer. Task context
+     * only. Wakes a waiting consumer if the buffer already holds the new
+     * level.
+     */
+    void set_watermark(std::size_t watermark) {
+        FreeRTOS::Kernel::enterCritical();
+        const bool wake = this->watermark.set_level(watermark, this->ring_buffer.size());
+        FreeRTOS::Kernel::exitCritical();
+        if (wake) {
+            this->semaphore.give();
+        }
+    }
+
+    /**
+     * @brief Push elements from either ISR or thread context.
+     *
+     * @return false if there is not enough free space, in which case nothing
+     * is pushed.
+     */
+    bool push(std::span<const T> values) {
+        if (FreeRTOS::Addons::Kernel::isInsideInterrupt()) {
+            return this->push_from_isr(values);
+        }
+        FreeRTOS::Kernel::enterCritical();
+        const auto [pushed, crossed] = this->push_locked(values);
+        FreeRTOS::Kernel::exitCritical();
+        if (crossed) {
+            this->semaphore.give();
+        }
+        return pushed;
+    }
+
+    bool push(const T &value) { return this->push(std::span<const T>{&value, 1}); }
+
+    /**
+     * @brief Wait until at least watermark elements are stored or the timeout
+     * expires, then pop up to out.size() elements. Consumer task only.
+     *
+     * Pops in chunks of critical_section_chunk_size, releasing the critical
+     * section in between, so interrupt latency does not grow with out.size().
+     *
+     * @return Number of elements popped; fewer than the watermark (possibly
+     * zero) on timeout.
+     */
+    std::size_t read(std::span<T> out, const Timeout &timeout = Timeout::max()) {
+        while (!this->watermark.reached(this->get_size())) {
+            // a give may be stale from a batch already read, hence the loop
+            if (this->semaphore.take(timeout.left().count()) != pdTRUE) {
+                break;
+            }
+        }
+        std::size_t popped = 0;
+        while (popped < out.size()) {
+            const auto chunk = out.subspan(popped, std::min(out.size() - popped, critical_section_chunk_size));
+            FreeRTOS::Kernel::enterCritical();
+            const std::size_t chunk_popped = this->ring_buffer.pop(chunk);
+            FreeRTOS::Kernel::exitCritical();
+            popped += chunk_popped;
+            if (chunk_popped < chunk.size()) {
+                break;
+            }
+        }
+        return popped;
+    }
+
+    /**
+     * @brief Returns the number of stored elements.
+     */
+    std::size_t get_size() {
+        FreeRTOS::Kernel::enterCritical();
+        const std::size_t size = this->ring_buffer.size();
+        FreeRTOS::Kernel::exitCritical();
+        return size;
+    }
+
+private:
+    struct PushResult {
+        bool pushed;
+        bool crossed; ///< fill level went from below to at or above the watermark
+    };
+
+    /**
+     * @brief Push with the ring buffer already locked.
+     */
+    PushResult push_locked(std::span<const T> values) {
+        const std::size_t size_before = this->ring_buffer.size();
+        if (!this->ring_buffer.push(values)) {
+            return {false, false};
+        }
+        return {true, this->watermark.crossed(size_before, this->ring_buffer.size())};
+    }
+
+    bool push_from_isr(std::span<const T> values) {
+        const auto interrupt_status = FreeRTOS::Kernel::enterCriticalFromISR();
+        const auto [pushed, crossed] = this->push_locked(values);
+        FreeRTOS::Kernel::exitCriticalFromISR(interrupt_status);
+        if (crossed) {
+            bool higherPriorityTaskWoken = false;
+            this->semaphore.giveFromISR(higherPriorityTaskWoken);
+            // must be called last in this function scope.
+            FreeRTOS::Kernel::yieldFromISR(higherPriorityTaskWoken);
+        }
+        return pushed;
+    }
+
+    RingBufferView<T, power_of_two> &ring_buffer;
+    FillWatermark watermark;
+    FreeRTOS::BinarySemaphore semaphore;
+};
+
+} // namespace ln::drivers
@@ -82,6 +82,38 @@ bool EventDrivenSpi::write(const std::uint8_t *data, std::size_t size, const Tim
     return true;
 }
 
+bool EventDrivenSpi::read(BufChain &chain, const Timeout &timeout) {
+    FreeRTOS::Addons::LockGuard lock_guard(this->mutex);
+    for (std::span<std::byte> segment : chain.writable_segments()) {
+        if (!this->ll_ensure_read_readiness(timeout)) {
+            return false;
+        }
+        if (!this->ll_read_async(reinterpret_cast<std::uint8_t *>(segment.data()), segment.size())) {
+            return false;
+        }
+        if (this->read_semaphore.take(timeout.left()) != pdTRUE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool EventDrivenSpi::write(const BufChain &chain, const Timeout &timeout) {
+    FreeRTOS::Addons::LockGuard lock_guard(this->mutex);
+    for (std::span<const std::byte> segment : chain.segments()) {
+        if (!this->ll_ensure_write_readiness(timeout)) {
+            return false;
+        }
+        if (!this->ll_write_async(reinterpret_cast<const std::uint8_t *>(segment.data()), segment.size())) {
+            return false;
+        }
+        if (this->write_semaphore.take(timeout.left()) != pdTRUE) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool EventDrivenSpi::write_async(const std::uint8_t *data, std::size_t size, const Timeout &timeout) {
     if (size == 0) {
         return true;
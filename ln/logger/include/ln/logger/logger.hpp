@@ -10,6 +10,7 @@
 #pragma once
 
 #include "ln/File.hpp"
+#include "ln/StaticString.hpp"
 
 extern "C"
 {
@@ -120,12 +121,11 @@ private:
     void clear_buffer_unsafe();
     void flush_buffer_unsafe();
 
-    int print_header(File &file, const LoggerModule &module, const Level &level) const;
-    static int printf(File &file, const char *fmt, ...);
+    void print_header(const LoggerModule &module, const Level &level);
 
     FreeRTOS::StaticRecursiveMutex mutex;
 
-    std::array<char, Config::out_buffer_size> buff_mem{};
+    ln::StaticString<Config::out_buffer_size - 1> buff;
 };
 
 /**
@@ -156,19 +156,19 @@ struct Hex {
         if (out_buff_size < 2) {
             return nullptr;
         }
-        size_t cp = 0;
-        size_t i = 0;
-        for (; i < in_size && cp < out_buff_size - 1; i++) {
-            cp += std::snprintf(out_buff_data + cp, out_buff_size - cp, byte_fmt, in_data[i]);
-            if (i + 1 < in_size) {
-                cp += std::snprintf(out_buff_data + cp, out_buff_size - cp, "%s", delimiter);
+        ln::StringBuffer out{{out_buff_data, out_buff_size}};
+        bool fits = true;
+        for (size_t i = 0; fits && i < in_size; i++) {
+            fits = out.appendf(byte_fmt, in_data[i]);
+            if (fits && i + 1 < in_size) {
+                fits = out.append(delimiter);
             }
         }
-        if (i < in_size) { // Indicate truncation
-            const auto offset = std::min(cp, out_buff_size - 2);
-            std::snprintf(out_buff_data + offset, out_buff_size - offset, "*");
+        if (!fits) { // Indicate truncation
+            out.truncate(out.capacity() - 1);
+            (void)out.append('*');
         }
-        return out_buff_data;
+        return out.c_str();
     }
 };
 
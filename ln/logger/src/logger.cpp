@@ -9,6 +9,7 @@
 
 #include "ln/logger/logger.hpp"
 #include "ln/ln.h"
+#include "ln/metrics.hpp"
 
 #include <FreeRTOS/Addons/LockGuard.hpp>
 #include <FreeRTOS/Addons/Clock.hpp>
@@ -18,6 +19,9 @@
 
 namespace ln::logger {
 
+static ln::metrics::Counter dropped_messages{"logger.dropped"};
+static ln::metrics::Counter truncated_messages{"logger.truncated"};
+
 extern "C" void ln_logger_log(LoggerModule *module, LoggerLevel level, const char *fmt, ...) {
     if (!module) {
         return;
@@ -65,13 +69,10 @@ void Logger::flush_buffer() {
     this->flush_buffer_unsafe();
 }
 
-void Logger::clear_buffer_unsafe() {
-    ln::File file(this->buff_mem, "w"); // effectively clears the buffer
-}
+void Logger::clear_buffer_unsafe() { this->buff.clear(); }
 
 void Logger::flush_buffer_unsafe() {
-    std::fwrite(this->buff_mem.data(), 1, std::min(strlen(this->buff_mem.data()), this->buff_mem.size()),
-                this->config.out_file.c_file());
+    std::fwrite(this->buff.data(), 1, this->buff.size(), this->config.out_file.c_file());
     this->clear_buffer_unsafe();
 }
 
@@ -107,11 +108,12 @@ int Logger::log(const LoggerModule &module, const Logger::Level &level, const st
                 const va_list &arg_list) {
     const auto is_interrupt_context = FreeRTOS::Addons::Kernel::isInsideInterrupt();
     if (!is_interrupt_context && !this->mutex.lock()) {
+        dropped_messages.add();
         return 0;
     }
     const auto rc = this->log_unsafe(module, level, fmt, arg_list);
     if (!is_interrupt_context) {
-        if (strlen(this->buff_mem.data()) > Config::out_buffer_auto_flush_threshold) {
+        if (this->buff.size() > Config::out_buffer_auto_flush_threshold) {
             this->flush_buffer_unsafe();
         }
         this->mutex.unlock();
@@ -120,17 +122,18 @@ int Logger::log(const LoggerModule &module, const Logger::Level &level, const st
 }
 int Logger::log_unsafe(const LoggerModule &module, const Logger::Level &level, const std::string_view fmt,
                        const va_list &arg_list) {
-    ln::File buff_file(this->buff_mem, "a+");
-    int chars_printed = 0;
+    const auto size_before = this->buff.size();
     if (this->config.print_header_enabled) {
-        LN_CHECK(this->print_header(buff_file, module, level), rc, rc < 0, { chars_printed += rc; }, {});
+        this->print_header(module, level);
+    }
+    const bool fits = this->buff.vappendf(fmt.data(), arg_list);
+    if (!this->buff.append(this->config.eol) || !fits) {
+        truncated_messages.add();
     }
-    LN_CHECK(vfprintf(buff_file.c_file(), fmt.data(), arg_list), rc, rc < 0, { chars_printed += rc; }, {});
-    LN_CHECK(fprintf(buff_file.c_file(), "%s", this->config.eol), rc, rc < 0, { chars_printed += rc; }, {});
-    return chars_printed;
+    return static_cast<int>(this->buff.size() - size_before);
 }
 
-int Logger::print_header(ln::File &file, const LoggerModule &module, const Logger::Level &level) const {
+void Logger::print_header(const LoggerModule &module, const Logger::Level &level) {
 
 #define ANSI_COLOR_BLACK "\e[30m"
 #define ANSI_COLOR_RED "\e[31m"
@@ -160,19 +163,12 @@ int Logger::print_header(ln::File &file, const LoggerModule &module, const Logge
     const auto ms = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(sec_remainder).count());
     std::strftime(datetime_buffer, sizeof(datetime_buffer), "%Y-%m-%d %H:%M:%S", &tm_buf);
     const auto current_task_name = FreeRTOS::Addons::Kernel::getCurrentTaskName();
-    return Logger::printf(file, "%s.%03lu|%s%s%s|%s%s|%s|", datetime_buffer, ms,
-                          (this->config.color ? level_descrs[level_descr_idx].color.data() : ""),
-                          level_descrs[level_descr_idx].tag_name.data(), (this->config.color ? ANSI_COLOR_DEFAULT : ""),
-                          (FreeRTOS::Addons::Kernel::isInsideInterrupt() ? "ISR!" : ""),
-                          (current_task_name ? current_task_name : "-"), module.name);
-}
-
-int Logger::printf(ln::File &file, const char *fmt, ...) {
-    va_list args;
-    va_start(args, fmt);
-    const auto rc = vfprintf(file.c_file(), fmt, args);
-    va_end(args);
-    return rc;
+    (void)this->buff.appendf("%s.%03lu|%s%s%s|%s%s|%s|", datetime_buffer, static_cast<unsigned long>(ms),
+                             (this->config.color ? level_descrs[level_descr_idx].color.data() : ""),
+                             level_descrs[level_descr_idx].tag_name.data(),
+                             (this->config.color ? ANSI_COLOR_DEFAULT : ""),
+                             (FreeRTOS::Addons::Kernel::isInsideInterrupt() ? "ISR!" : ""),
+                             (current_task_name ? current_task_name : "-"), module.name);
 }
 
 } // namespace ln::logger
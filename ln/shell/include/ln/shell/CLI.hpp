@@ -37,11 +37,21 @@
 
 namespace ln::shell {
 
+/**
+ * @brief Interactive command line over a character stream.
+ *
+ * A CLI, its scratch arena included, is used from one task only. Other tasks
+ * that execute commands do so through a CLI of their own, as the repeat
+ * command does.
+ */
 class CLI {
 public:
     struct Config {
         File ostream = File(stdout);
         static constexpr std::size_t printf_buffer_size = 256;
+        // command name tokens (e.g. "help" and "?" of "help,?") indexed for O(1) lookup, beyond that lookup falls
+        // back to scanning the command lists
+        static constexpr std::size_t cmd_name_index_capacity = 32;
         static constexpr bool regular_response_is_enabled = true;
         bool colored_output = true;
         bool print_result_tags = false;
@@ -50,8 +60,16 @@ public:
         std::span<ln::StaticForwardList<Cmd> *> cmd_lists = default_cmd_lists;
     } config;
 
-    explicit CLI(std::span<char> input_line_buf, std::span<char> history_buf = {})
-        : input{input_line_buf}, history{history_buf} {}
+    /**
+     * @param history_buf Backing storage of the command history, empty to
+     * disable it. Only its largest power of two prefix is used.
+     * @param arena_buf Backing storage of the per-command scratch arena
+     * (Cmd::Ctx::arena), empty to disable it. printf() formats in it too,
+     * falling back to the stack when it has no room.
+     */
+    explicit CLI(std::span<char> input_line_buf, std::span<char> history_buf = {},
+                 std::span<std::byte> arena_buf = {})
+        : input{input_line_buf}, history{history_buf}, arena{arena_buf} {}
 
     // NOTE: escape sequences are time sensitive !
     // TODO: move this to a dedicated uart receiver task and join by char queue
@@ -100,6 +118,7 @@ private:
     Input input;
     friend class History;
     History history;
+    ln::MonotonicArena arena;
     bool previously_called_from_history = false;
     Err last_err = Err::ok;
 };
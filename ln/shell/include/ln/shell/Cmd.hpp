@@ -11,6 +11,7 @@
 
 #include "ln/shell/Parser.hpp"
 
+#include "ln/Arena.hpp"
 #include "ln/StaticForwardList.hpp"
 
 #include <functional>
@@ -38,6 +39,11 @@ public:
         CLI &cli;
         ArgParser &argp;
         std::span<const std::string_view> args; // TODO: deprecated and remove becuase argp has args
+        /**
+         * @brief Scratch memory for the duration of the command. Everything
+         * allocated here is released when the command function returns.
+         */
+        ln::MonotonicArena &arena;
     };
 
     using Fn = std::function<Err(Ctx)>;
@@ -114,7 +120,7 @@ public:
 private:
     friend CLI;
 
-    static const Cmd *find_cmd_by_name(ln::StaticForwardList<Cmd> cmd_list, std::string_view name);
+    static const Cmd *find_cmd_by_name(const ln::StaticForwardList<Cmd> &cmd_list, std::string_view name);
     const Cmd *find_child_cmd_by_name(std::string_view name) const;
     std::size_t resolve_cmd_depth() const;
 
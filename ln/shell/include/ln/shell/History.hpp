@@ -12,6 +12,7 @@
 #include "ln/RingBuffer.hpp"
 #include "ln/shell/Cmd.hpp"
 
+#include <bit>
 #include <span>
 
 namespace ln::shell {
@@ -19,19 +20,23 @@ namespace ln::shell {
 class History {
 
 public:
-    History(std::span<char> history_buf) : ring_buffer(history_buf) {}
+    // mask indexed, so only the largest power of two prefix of history_buf is used
+    using Buffer = ln::PowerOfTwoRingBufferView<char>;
+
+    History(std::span<char> history_buf) : ring_buffer(history_buf.first(std::bit_floor(history_buf.size()))) {}
 
     void add_line(std::string_view line);
-    std::ranges::subrange<ln::RingBufferView<char>::iterator> get_current_recall_line();
-    std::ranges::subrange<ln::RingBufferView<char>::iterator> recall_previous();
-    std::ranges::subrange<ln::RingBufferView<char>::iterator> recall_next();
+    std::ranges::subrange<Buffer::iterator> get_current_recall_line();
+    std::ranges::subrange<Buffer::iterator> recall_previous();
+    std::ranges::subrange<Buffer::iterator> recall_next();
 
 private:
     static Err cmd_history_fn(Cmd::Ctx ctx);
+    Buffer::iterator iterator_at(std::size_t index);
     static Cmd cmd_history;
 
-    ln::RingBufferView<char> ring_buffer;
-    ln::RingBufferView<char>::iterator recall_pos = ring_buffer.end();
+    Buffer ring_buffer;
+    Buffer::iterator recall_pos = ring_buffer.end();
     bool last_recall_was_matching = false;
 };
 
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "ln/StaticString.hpp"
+
 #include <cstddef>
 #include <string_view>
 #include <span>
@@ -17,7 +19,7 @@ namespace ln::shell {
 
 class Input {
 public:
-    explicit Input(std::span<char> line_buf) : line_buf(line_buf) {}
+    explicit Input(std::span<char> line_buf) : line(line_buf) {}
     Input() = delete;
     Input(const Input &) = delete;
     Input &operator=(const Input &) = delete;
@@ -27,7 +29,7 @@ public:
 
     void clear();
 
-    [[nodiscard]] std::string_view get() const { return std::string_view{this->line_buf.data(), this->chars_used}; }
+    [[nodiscard]] std::string_view get() const { return this->line.view(); }
     [[nodiscard]] size_t get_cursor_pos() const { return this->cursor_idx; }
 
     [[nodiscard]] bool is_full() const;
@@ -44,9 +46,8 @@ public:
     bool insert(const char &c);
 
 private:
-    std::span<char> line_buf;
+    ln::StringBuffer line;
     std::size_t cursor_idx = 0;
-    std::size_t chars_used = 0;
 };
 
 } // namespace ln::shell
@@ -9,15 +9,23 @@
 
 #include "ln/shell/CLI.hpp"
 #include "ln/shell/Parser.hpp"
+#include "ln/StaticString.hpp"
+#include "ln/metrics.hpp"
 // TODO: make arrow up repeat buffer
 // TODO: some kind of esacpe signal mechanism to inform running cmd to exit.
 
+#include "FreeRTOS/Addons/Clock.hpp"
+
+#include <chrono>
 #include <cstdio>
 #include <cstring>
 #include <type_traits>
 
 namespace ln::shell {
 
+static ln::metrics::Histogram<3, 20> cmd_duration_ms{"shell.cmd_ms"};
+static ln::metrics::Counter cmd_failures{"shell.cmd_failures"};
+
 void CLI::print(const char &c, size_t times_to_repeat) {
     while (times_to_repeat--) {
         if (c == '\n') {
@@ -40,13 +48,28 @@ int CLI::print(const char *str) {
     return rc;
 }
 
+// kept out of line so the stack buffer only costs when the arena has no room for it
+[[gnu::noinline]] static int vprintf_on_stack(CLI &cli, const char *fmt, va_list args) {
+    ln::StaticString<CLI::Config::printf_buffer_size - 1> tx_buf;
+    (void)tx_buf.vappendf(fmt, args);
+    return cli.print(tx_buf.view());
+}
+
 int CLI::printf(const char *fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    std::array<char, Config::printf_buffer_size> tx_buf;
-    vsnprintf(tx_buf.data(), tx_buf.size(), fmt, args);
-    int chars_printed = this->print(tx_buf.data());
+    int chars_printed = 0;
+    const auto arena_used_space = this->arena.get_used_space();
+    if (const auto buf = this->arena.allocate<char>(Config::printf_buffer_size); !buf.empty()) {
+        ln::StringBuffer tx_buf{buf};
+        (void)tx_buf.vappendf(fmt, args);
+        chars_printed = this->print(tx_buf.view());
+    }
+    else {
+        chars_printed = vprintf_on_stack(*this, fmt, args);
+    }
     va_end(args);
+    this->arena.rewind(arena_used_space);
     return chars_printed;
 }
 
@@ -104,7 +127,17 @@ Err CLI::execute(const Cmd &cmd, const std::span<const std::string_view> args,
         return Err::badArg;
     }
     this->print(output_color_escape_sequence); // response in green
-    const auto err = cmd.cfg.fn(Cmd::Ctx{*this, argp, args});
+    // rewind rather than reset, a command may execute nested commands
+    const auto arena_used_space = this->arena.get_used_space();
+    using Clock = FreeRTOS::Addons::Clock;
+    const auto started = Clock::now();
+    const auto err = cmd.cfg.fn(Cmd::Ctx{*this, argp, args, this->arena});
+    cmd_duration_ms.record(static_cast<std::uint32_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - started).count()));
+    if (static_cast<std::int8_t>(err) < 0) {
+        cmd_failures.add();
+    }
+    this->arena.rewind(arena_used_space);
     if (!Config::regular_response_is_enabled) {
         return err;
     }
@@ -10,6 +10,8 @@
 #include "ln/shell/Cmd.hpp"
 #include "ln/shell/CLI.hpp"
 
+#include "ln/StaticHashMap.hpp"
+
 // TODO: make arrow up repeat buffer
 #include <cstring>
 
@@ -19,10 +21,46 @@ ln::StaticForwardList<Cmd> Cmd::base_cmd_list = {};
 ln::StaticForwardList<Cmd> Cmd::general_cmd_list = {};
 ln::StaticForwardList<Cmd> Cmd::global_cmd_list = {};
 
+namespace {
+
+struct CmdNameKey {
+    const ln::StaticForwardList<Cmd> *cmd_list;
+    std::string_view name;
+
+    bool operator==(const CmdNameKey &) const = default;
+};
+
+struct CmdNameKeyHash {
+    std::size_t operator()(const CmdNameKey &key) const noexcept {
+        return ln::Hash<const void *>{}(key.cmd_list) ^ ln::Hash<std::string_view>{}(key.name);
+    }
+};
+
+// constant-initialized, so it is ready before the static commands register
+constinit ln::StaticHashMap<CmdNameKey, const Cmd *, CLI::Config::cmd_name_index_capacity, CmdNameKeyHash>
+    cmd_name_index{};
+constinit bool cmd_name_index_complete = true;
+
+} // namespace
+
 Cmd::Cmd(Cfg cfg) : cfg{std::move(cfg)} {
 
     auto &cmd_list = this->cfg.parent_cmd ? this->cfg.parent_cmd->children_cmd_list : this->cfg.cmd_list;
     cmd_list.push_front(*this);
+
+    if (!this->cfg.name) {
+        return;
+    }
+    // the latest command wins a name, like the front of the list does
+    std::string_view names = this->cfg.name;
+    while (!names.empty()) {
+        const std::size_t comma = names.find(',');
+        const std::string_view name = names.substr(0, comma);
+        if (!name.empty() && !cmd_name_index.insert_or_assign(CmdNameKey{&cmd_list, name}, this)) {
+            cmd_name_index_complete = false;
+        }
+        names = comma == std::string_view::npos ? std::string_view{} : names.substr(comma + 1);
+    }
 }
 
 static bool matches_any_token(std::string_view str_token, const char *str_tokens) {
@@ -44,7 +82,11 @@ static bool matches_any_token(std::string_view str_token, const char *str_tokens
     return false;
 }
 
-const Cmd *Cmd::find_cmd_by_name(ln::StaticForwardList<Cmd> cmd_list, std::string_view name) {
+const Cmd *Cmd::find_cmd_by_name(const ln::StaticForwardList<Cmd> &cmd_list, std::string_view name) {
+    if (cmd_name_index_complete) {
+        const Cmd *const *cmd = cmd_name_index.find(CmdNameKey{&cmd_list, name});
+        return cmd ? *cmd : nullptr;
+    }
     for (const auto &cmd : cmd_list) {
         if (matches_any_token(name, cmd.cfg.name)) {
             return &cmd;
@@ -54,12 +96,7 @@ const Cmd *Cmd::find_cmd_by_name(ln::StaticForwardList<Cmd> cmd_list, std::strin
 }
 
 const Cmd *Cmd::find_child_cmd_by_name(std::string_view name) const {
-    for (const auto &cmd : this->children_cmd_list) {
-        if (matches_any_token(name, cmd.cfg.name)) {
-            return &cmd;
-        }
-    }
-    return nullptr;
+    return find_cmd_by_name(this->children_cmd_list, name);
 }
 
 void Cmd::print_short_help(CLI &cli, std::size_t max_depth, std::size_t depth) const {
@@ -19,12 +19,15 @@ LOG_MODULE(cli_history, LOGGER_LEVEL_INFO);
 
 namespace ln::shell {
 
-std::ranges::subrange<ln::RingBufferView<char>::iterator> History::get_current_recall_line() {
-    auto range = std::ranges::subrange{this->recall_pos, this->ring_buffer.end()};
-    return std::ranges::subrange{this->recall_pos, std::ranges::find(range, '\n')};
+std::ranges::subrange<History::Buffer::iterator> History::get_current_recall_line() {
+    const auto line_end = this->ring_buffer.find('\n', this->recall_pos.index);
+    return std::ranges::subrange{this->recall_pos, this->iterator_at(line_end)};
 }
 
 void History::add_line(std::string_view line) {
+    if (this->ring_buffer.capacity() == 0) {
+        return;
+    }
     if (!this->ring_buffer.push_overwrite(line)) {
         LN_PANIC();
         return;
@@ -36,32 +39,30 @@ void History::add_line(std::string_view line) {
     this->recall_pos = this->ring_buffer.end();
 }
 
-std::ranges::subrange<ln::RingBufferView<char>::iterator> History::recall_previous() {
-    auto line_begin_it = this->ring_buffer.begin();
-    auto line_end_it = this->recall_pos;
-    auto range = std::ranges::subrange{line_begin_it, line_end_it} | std::views::reverse;
-    if (auto it = std::ranges::find(range, '\n'); it != std::ranges::end(range)) {
-        line_end_it = std::prev(it.base());
-    }
-    range = std::ranges::subrange{line_begin_it, line_end_it} | std::views::reverse;
-    auto it = std::ranges::find(range, '\n');
-    this->recall_pos = it.base();
-    return std::ranges::subrange{this->recall_pos, line_end_it};
+std::ranges::subrange<History::Buffer::iterator> History::recall_previous() {
+    // rfind() returns the range end when nothing is found.
+    const auto line_end = this->ring_buffer.rfind('\n', 0, this->recall_pos.index);
+    const auto prev_line_end = this->ring_buffer.rfind('\n', 0, line_end);
+    const auto line_begin = prev_line_end == line_end ? 0 : prev_line_end + 1;
+    this->recall_pos = this->iterator_at(line_begin);
+    return std::ranges::subrange{this->recall_pos, this->iterator_at(line_end)};
 }
 
-std::ranges::subrange<ln::RingBufferView<char>::iterator> History::recall_next() {
-    auto line_begin_it = this->recall_pos;
-    auto line_end_it = this->ring_buffer.end();
-    auto range = std::ranges::subrange{line_begin_it, line_end_it};
-    if (auto it = std::ranges::find(range, '\n'); it != std::ranges::end(range)) {
-        line_begin_it = std::next(it);
+std::ranges::subrange<History::Buffer::iterator> History::recall_next() {
+    auto line_begin = this->recall_pos.index;
+    if (const auto current_line_end = this->ring_buffer.find('\n', line_begin);
+        current_line_end != this->ring_buffer.size()) {
+        line_begin = current_line_end + 1;
     }
-    range = std::ranges::subrange{line_begin_it, line_end_it};
-    auto it = std::ranges::find(range, '\n');
-    if (it != std::ranges::end(range)) {
-        this->recall_pos = line_begin_it;
+    const auto line_end = this->ring_buffer.find('\n', line_begin);
+    if (line_end != this->ring_buffer.size()) {
+        this->recall_pos = this->iterator_at(line_begin);
     }
-    return std::ranges::subrange{line_begin_it, it};
+    return std::ranges::subrange{this->iterator_at(line_begin), this->iterator_at(line_end)};
+}
+
+History::Buffer::iterator History::iterator_at(std::size_t index) {
+    return Buffer::iterator{&this->ring_buffer, index};
 }
 
 Err History::cmd_history_fn(Cmd::Ctx ctx) {
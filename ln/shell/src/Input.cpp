@@ -9,22 +9,20 @@
 
 #include "ln/shell/Input.hpp"
 
-#include <cstring>
-
 namespace ln::shell {
 
 void Input::clear() {
-    this->chars_used = 0;
+    this->line.clear();
     this->cursor_idx = 0;
 }
 
 bool Input::is_cursor_on_base() const { return (this->cursor_idx == 0); }
 
-bool Input::is_cursor_on_end() const { return this->chars_used == this->cursor_idx; }
+bool Input::is_cursor_on_end() const { return this->line.size() == this->cursor_idx; }
 
 bool Input::is_empty() const { return (this->is_cursor_on_base() && this->is_cursor_on_end()); }
 
-bool Input::is_full() const { return (this->chars_used == this->line_buf.size()); }
+bool Input::is_full() const { return this->line.full(); }
 
 bool Input::step_right() {
     if (this->is_cursor_on_end()) {
@@ -49,9 +47,7 @@ bool Input::delete_char() {
     if (this->is_empty() || this->is_cursor_on_end()) {
         return false;
     }
-    std::memmove(&this->line_buf[this->cursor_idx], &this->line_buf[this->cursor_idx + 1],
-                 this->chars_used - (this->cursor_idx + 1));
-    this->chars_used--;
+    this->line.erase(this->cursor_idx);
     return true;
 }
 
@@ -59,24 +55,16 @@ bool Input::backspace_char() {
     if (this->is_cursor_on_base()) {
         return false;
     }
-    if (!this->is_cursor_on_end()) {
-        std::memmove(&this->line_buf[this->cursor_idx - 1], &this->line_buf[this->cursor_idx],
-                     this->chars_used - this->cursor_idx + 1);
-    }
     this->cursor_idx--;
-    this->chars_used--;
+    this->line.erase(this->cursor_idx);
     return true;
 }
 
 bool Input::insert(const char &c) {
-    if (this->is_full()) {
+    if (!this->line.insert(this->cursor_idx, c)) {
         return false;
     }
-    std::memmove(&this->line_buf[this->cursor_idx + 1], &this->line_buf[this->cursor_idx],
-                 this->chars_used - this->cursor_idx);
-    this->line_buf[this->cursor_idx] = c;
     this->cursor_idx++;
-    this->chars_used++;
     return true;
 }
 
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "ln/shell/CLI.hpp"
+
+#if LN_HEAP_TRACKING
+#include "ln/heap_tracking.hpp"
+#endif
+
+#include "FreeRTOS.h"
+
+#include <array>
+#include <span>
+#include <string_view>
+
+namespace ln::shell {
+
+#if LN_HEAP_TRACKING
+static void print_heap_sites(CLI &cli, HeapTracker::Order order) {
+    const auto totals = ln::heap_tracking::get_totals();
+    cli.printf("tracked: %lu live allocations, %lu B, peak %lu B\n", static_cast<unsigned long>(totals.live_count),
+               static_cast<unsigned long>(totals.live_size), static_cast<unsigned long>(totals.peak_size));
+    cli.printf("         %lu allocations from %lu call sites, %lu untracked\n",
+               static_cast<unsigned long>(totals.allocation_count), static_cast<unsigned long>(totals.site_count),
+               static_cast<unsigned long>(totals.untracked_count));
+
+    std::array<HeapTracker::Site, 8> sites{};
+    const std::size_t count = ln::heap_tracking::get_top_sites(sites, order);
+    cli.printf("%-12s %8s %8s %8s %8s\n", "caller", "live", "bytes", "peak", "allocs");
+    for (const auto &site : std::span{sites}.first(count)) {
+        cli.printf("%-12p %8lu %8lu %8lu %8lu\n", site.caller, static_cast<unsigned long>(site.live_count),
+                   static_cast<unsigned long>(site.live_size), static_cast<unsigned long>(site.peak_size),
+                   static_cast<unsigned long>(site.allocation_count));
+    }
+}
+#endif
+
+Cmd cmd_heap{Cmd::Cfg{
+    .cmd_list = Cmd::general_cmd_list,
+    .name = "heap",
+    .usage = "[churn|reset]",
+    .short_description = "heap usage and top allocating call sites",
+    .long_description = "Without arguments, lists the call sites holding the most memory. `churn` lists the\n"
+                        "call sites allocating most often, `reset` restarts peak tracking. Resolve a caller\n"
+                        "address with `addr2line -e <elf> <caller>`. Call sites require LN_HEAP_TRACKING.",
+    .fn = [](Cmd::Ctx ctx) {
+        using namespace std::literals::string_view_literals;
+        if (ctx.args.size() > 1) {
+            return Err::badArg;
+        }
+        const std::string_view action = ctx.args.empty() ? ""sv : ctx.args[0];
+        if (action != ""sv && action != "churn"sv && action != "reset"sv) {
+            return Err::badArg;
+        }
+#if LN_HEAP_TRACKING
+        if (action == "reset"sv) {
+            ln::heap_tracking::reset_peaks();
+            return Err::ok;
+        }
+#endif
+        ctx.cli.printf("FreeRTOS heap: %lu B free, %lu B minimum ever free\n",
+                       static_cast<unsigned long>(xPortGetFreeHeapSize()),
+                       static_cast<unsigned long>(xPortGetMinimumEverFreeHeapSize()));
+#if LN_HEAP_TRACKING
+        print_heap_sites(ctx.cli, action == "churn"sv ? HeapTracker::Order::allocation_count
+                                                      : HeapTracker::Order::live_size);
+        return Err::ok;
+#else
+        if (!action.empty()) {
+            ctx.cli.print("error: call site tracking requires LN_HEAP_TRACKING\n");
+            return Err::fail;
+        }
+        return Err::ok;
+#endif
+    }}};
+
+} // namespace ln::shell
@@ -9,6 +9,11 @@
 
 #include "ln/shell/CLI.hpp"
 
+#if LN_HEAP_TRACKING
+#include "ln/heap_tracking.hpp"
+#endif
+
+#include <cstring>
 #include <string_view>
 
 extern "C"
@@ -20,9 +25,80 @@ extern "C"
 
 namespace ln::shell {
 
+#if LN_HEAP_TRACKING
+// luaL_newstate() allocates with libc realloc, which the tracker does not see; all Lua memory is attributed to
+// this function instead, resolve it with addr2line like any other call site
+static void *lua_tracked_alloc(void * /*ud*/, void *ptr, size_t osize, size_t nsize) {
+    // for a new block osize encodes the Lua object type, not a size
+    const auto *caller = reinterpret_cast<const void *>(&lua_tracked_alloc);
+    return ln::heap_tracking::reallocate(ptr, ptr ? osize : 0, nsize, caller);
+}
+
+// lua_newstate() installs no handlers, these mirror the ones luaL_newstate() installs
+
+static int lua_tracked_panic(lua_State *L) {
+    const char *msg = lua_type(L, -1) == LUA_TSTRING ? lua_tostring(L, -1) : "error object is not a string";
+    lua_writestringerror("PANIC: unprotected error in call to Lua API (%s)\n", msg);
+    return 0; // return to Lua to abort
+}
+
+#if LUA_VERSION_NUM >= 504
+static void lua_warn_off(void *ud, const char *message, int tocont);
+static void lua_warn_on(void *ud, const char *message, int tocont);
+
+// "@on" and "@off" switch warnings on and off, they start off
+static bool lua_warn_control(lua_State *L, const char *message, int tocont) {
+    if (tocont || *message != '@') {
+        return false;
+    }
+    if (std::strcmp(message + 1, "off") == 0) {
+        lua_setwarnf(L, lua_warn_off, L);
+    }
+    else if (std::strcmp(message + 1, "on") == 0) {
+        lua_setwarnf(L, lua_warn_on, L);
+    }
+    return true;
+}
+
+static void lua_warn_off(void *ud, const char *message, int tocont) {
+    (void)lua_warn_control(static_cast<lua_State *>(ud), message, tocont);
+}
+
+static void lua_warn_continue(void *ud, const char *message, int tocont) {
+    auto *L = static_cast<lua_State *>(ud);
+    lua_writestringerror("%s", message);
+    if (tocont) {
+        lua_setwarnf(L, lua_warn_continue, L);
+    }
+    else {
+        lua_writestringerror("%s", "\n");
+        lua_setwarnf(L, lua_warn_on, L);
+    }
+}
+
+static void lua_warn_on(void *ud, const char *message, int tocont) {
+    if (lua_warn_control(static_cast<lua_State *>(ud), message, tocont)) {
+        return;
+    }
+    lua_writestringerror("%s", "Lua warning: ");
+    lua_warn_continue(ud, message, tocont);
+}
+#endif
+#endif
+
 Cmd cmd_lua{Cmd::Cfg{
     .cmd_list = Cmd::general_cmd_list, .name = "lua", .short_description = "runs lua code", .fn = [](Cmd::Ctx ctx) {
+#if LN_HEAP_TRACKING
+        lua_State *L = lua_newstate(lua_tracked_alloc, nullptr);
+        if (L) {
+            lua_atpanic(L, lua_tracked_panic);
+#if LUA_VERSION_NUM >= 504
+            lua_setwarnf(L, lua_warn_off, L);
+#endif
+        }
+#else
         lua_State *L = luaL_newstate();
+#endif
         luaL_openlibs(L);
         std::string_view code_sv{ctx.args.front().cbegin(), ctx.args.back().cend()};
         if (luaL_loadbuffer(L, code_sv.data(), code_sv.size(), code_sv.data()) == LUA_OK) {
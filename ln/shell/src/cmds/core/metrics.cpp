@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Lukas Neverauskis https://github.com/lukasnee
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "ln/shell/CLI.hpp"
+#include "ln/metrics.hpp"
+
+#include <string_view>
+
+namespace ln::shell {
+
+using ln::metrics::Counter;
+using ln::metrics::Gauge;
+using ln::metrics::HistogramBase;
+using ln::metrics::Metric;
+
+static void print_metric_text(CLI &cli, const Metric &metric) {
+    switch (metric.get_kind()) {
+    case Metric::Kind::counter:
+        cli.printf("%-32s counter   %lu\n", metric.get_name(),
+                   static_cast<unsigned long>(static_cast<const Counter &>(metric).get()));
+        break;
+    case Metric::Kind::gauge:
+        cli.printf("%-32s gauge     %ld\n", metric.get_name(),
+                   static_cast<long>(static_cast<const Gauge &>(metric).get()));
+        break;
+    case Metric::Kind::histogram: {
+        const auto &histogram = static_cast<const HistogramBase &>(metric);
+        cli.printf("%-32s histogram n=%lu min=%lu p50=%lu p90=%lu p99=%lu max=%lu\n", metric.get_name(),
+                   static_cast<unsigned long>(histogram.get_count()), static_cast<unsigned long>(histogram.get_min()),
+                   static_cast<unsigned long>(histogram.get_quantile(500)),
+                   static_cast<unsigned long>(histogram.get_quantile(900)),
+                   static_cast<unsigned long>(histogram.get_quantile(990)),
+                   static_cast<unsigned long>(histogram.get_max()));
+        break;
+    }
+    }
+}
+
+// one line per metric: `#metric <kind> <name> key=value...`, see ln/shell/tools/shell.py --metrics
+static void print_metric_line(CLI &cli, const Metric &metric) {
+    switch (metric.get_kind()) {
+    case Metric::Kind::counter:
+        cli.printf("#metric counter %s value=%lu\n", metric.get_name(),
+                   static_cast<unsigned long>(static_cast<const Counter &>(metric).get()));
+        break;
+    case Metric::Kind::gauge:
+        cli.printf("#metric gauge %s value=%ld\n", metric.get_name(),
+                   static_cast<long>(static_cast<const Gauge &>(metric).get()));
+        break;
+    case Metric::Kind::histogram: {
+        const auto &histogram = static_cast<const HistogramBase &>(metric);
+        cli.printf("#metric histogram %s count=%lu min=%lu max=%lu buckets=", metric.get_name(),
+                   static_cast<unsigned long>(histogram.get_count()), static_cast<unsigned long>(histogram.get_min()),
+                   static_cast<unsigned long>(histogram.get_max()));
+        // non-empty buckets only, as <lower bound>:<count>
+        const char *separator = "";
+        for (size_t i = 0; i < histogram.get_bucket_count(); ++i) {
+            const auto bucket = histogram.get_bucket(i);
+            if (bucket.count) {
+                cli.printf("%s%lu:%lu", separator, static_cast<unsigned long>(bucket.lower),
+                           static_cast<unsigned long>(bucket.count));
+                separator = ",";
+            }
+        }
+        cli.print("\n");
+        break;
+    }
+    }
+}
+
+Cmd cmd_metrics{Cmd::Cfg{
+    .cmd_list = Cmd::general_cmd_list,
+    .name = "metrics",
+    .usage = "[raw|reset]",
+    .short_description = "counters, gauges and histograms",
+    .long_description = "Without arguments, prints every registered metric with histogram percentiles. `raw`\n"
+                        "prints one `#metric <kind> <name> key=value...` line per metric for scripts, with\n"
+                        "histogram buckets as <lower bound>:<count>. `reset` zeroes counters and histograms.",
+    .fn = [](Cmd::Ctx ctx) {
+        using namespace std::literals::string_view_literals;
+        if (ctx.args.size() > 1) {
+            return Err::badArg;
+        }
+        const std::string_view action = ctx.args.empty() ? ""sv : ctx.args[0];
+        if (action != ""sv && action != "raw"sv && action != "reset"sv) {
+            return Err::badArg;
+        }
+        for (Metric *metric = ln::metrics::get_first(); metric; metric = metric->get_next()) {
+            if (action == "reset"sv) {
+                if (metric->get_kind() == Metric::Kind::counter) {
+                    static_cast<Counter *>(metric)->reset();
+                }
+                else if (metric->get_kind() == Metric::Kind::histogram) {
+                    static_cast<HistogramBase *>(metric)->reset();
+                }
+            }
+            else if (action == "raw"sv) {
+                print_metric_line(ctx.cli, *metric);
+            }
+            else {
+                print_metric_text(ctx.cli, *metric);
+            }
+        }
+        return Err::ok;
+    }}};
+
+} // namespace ln::shell
@@ -8,6 +8,8 @@
  */
 
 #include "ln/shell/CLI.hpp"
+#include "ln/Pool.hpp"
+#include "ln/StaticString.hpp"
 
 // #include "system.hpp"
 
@@ -15,6 +17,7 @@
 #include "FreeRTOS/Addons/Clock.hpp"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace ln::shell {
@@ -24,13 +27,14 @@ namespace ln::shell {
 class RepeatCommandThread : public FreeRTOS::Task {
 public:
     using Clock = FreeRTOS::Addons::Clock;
-    RepeatCommandThread(CLI &cli, Clock::duration period, const std::string_view line)
-        : Task{tskIDLE_PRIORITY + 1, 1000, "repeat"}, cli{cli}, period{period} {
-        if (line.size() >= line_buf.size()) {
-            this->cli.printf("error: arguments too long for repeat command\n");
-            return;
+    RepeatCommandThread(CLI &shell_cli, Clock::duration period, const std::string_view line)
+        : Task{tskIDLE_PRIORITY + 1, 1000, "repeat"}, cli{{}, {}, this->arena_buf}, period{period} {
+        // a CLI of its own, so the repeated command never shares the shell task's arena
+        this->cli.config = shell_cli.config;
+        if (!this->line.append(line)) {
+            shell_cli.printf("error: arguments too long for repeat command\n");
+            this->line.clear();
         }
-        this->line = std::string_view{this->line_buf.data(), line.copy(this->line_buf.data(), this->line_buf.size())};
     }
 
 private:
@@ -42,12 +46,15 @@ private:
         }
     }
 
-    CLI &cli;
+    alignas(std::max_align_t) std::array<std::byte, CLI::Config::printf_buffer_size> arena_buf{};
+    CLI cli;
     Clock::duration period;
-    std::array<char, 256> line_buf;
-    std::string_view line{};
+    ln::StaticString<255> line;
 };
 
+// only one repeat thread exists at a time, a dedicated pool keeps it off the general heap
+ln::Pool<RepeatCommandThread, 1> repeat_thread_pool;
+
 // TODO: implement quotes for allowing multiple COMMAND arguments with spaces etc.
 Cmd repeat{Cmd::Cfg{.cmd_list = Cmd::general_cmd_list,
                     .name = "repeat,r",
@@ -56,8 +63,7 @@ Cmd repeat{Cmd::Cfg{.cmd_list = Cmd::general_cmd_list,
                     .fn = [](Cmd::Ctx ctx) {
                         static RepeatCommandThread *thread = nullptr;
                         if (ctx.args.size() == 0 && thread) {
-                            thread->~RepeatCommandThread();
-                            vPortFree(thread);
+                            repeat_thread_pool.destroy(thread);
                             thread = nullptr;
                             ctx.cli.printf("repeat thread stopped\n");
                             return Err::ok;
@@ -67,16 +73,15 @@ Cmd repeat{Cmd::Cfg{.cmd_list = Cmd::general_cmd_list,
                                 return Err::fail;
                             }
                             auto expr_sv = ctx.args[1];
-                            void *thread_obj_mem = pvPortMalloc(sizeof(RepeatCommandThread));
-                            if (!thread_obj_mem) {
+                            const auto repeat_period =
+                                std::chrono::milliseconds(std::strtoul(ctx.args[0].data(), nullptr, 10));
+                            thread = repeat_thread_pool.create(ctx.cli, repeat_period, expr_sv);
+                            if (!thread) {
                                 ctx.cli.printf("error: could not allocate memory for repeat thread\n");
                                 return Err::fail;
                             }
-                            const auto repeat_period =
-                                std::chrono::milliseconds(std::strtoul(ctx.args[0].data(), nullptr, 10));
                             ctx.cli.printf("repeating \'%.*s\' every %lu ms\n\n", expr_sv.size(), expr_sv.data(),
                                            repeat_period.count());
-                            thread = new (thread_obj_mem) RepeatCommandThread(ctx.cli, repeat_period, expr_sv);
                             return Err::ok;
                         }
                         return Err::badArg;
@@ -2,7 +2,9 @@
 
 import sys
 import argparse
+import json
 import threading
+import time
 import tty
 import termios
 import glob
@@ -28,6 +30,47 @@ def find_serial_devices():
     return sorted(devices)
 
 
+def parse_metric_line(line):
+    """Parse a `#metric <kind> <name> key=value...` line printed by `metrics raw`"""
+    start = line.find("#metric ")
+    if start < 0:
+        return None
+    words = line[start:].split()
+    if len(words) < 3:
+        return None
+    kind, name, fields = words[1], words[2], words[3:]
+    metric = {"kind": kind}
+    for field in fields:
+        key, _, value = field.partition("=")
+        if key == "buckets":
+            # [lower bound, count] pairs of the non-empty buckets
+            metric[key] = [
+                [int(n) for n in bucket.split(":")] for bucket in value.split(",") if bucket
+            ]
+        else:
+            metric[key] = int(value)
+    return name, metric
+
+
+def scrape_metrics(ser, idle_timeout=0.5):
+    """Run `metrics raw` on the device and collect the metrics it prints by name"""
+    ser.reset_input_buffer()
+    ser.write(b"metrics raw\r")
+    output = b""
+    last_data = time.monotonic()
+    while time.monotonic() - last_data < idle_timeout:
+        data = ser.read(ser.in_waiting or 1)
+        if data:
+            output += data
+            last_data = time.monotonic()
+    metrics = {}
+    for line in output.decode("utf-8", errors="ignore").splitlines():
+        parsed = parse_metric_line(line)
+        if parsed:
+            metrics[parsed[0]] = parsed[1]
+    return metrics
+
+
 def main():
     parser = argparse.ArgumentParser(
         description="Live serial communication using pyserial"
@@ -52,6 +95,12 @@ def main():
         action="store_true",
         help="reset device on connect using OpenOCD",
     )
+    parser.add_argument(
+        "-m",
+        "--metrics",
+        action="store_true",
+        help="print the device metrics as JSON and exit",
+    )
 
     args = parser.parse_args()
 
@@ -81,6 +130,10 @@ def main():
                 except (ValueError, KeyboardInterrupt):
                     print("\nExiting...")
                     sys.exit(0)
+    if args.metrics:
+        with serial.Serial(device, args.baudrate, timeout=0.1) as ser:
+            print(json.dumps(scrape_metrics(ser), indent=2))
+        return
     old_settings = termios.tcgetattr(sys.stdin)
     stop_reading = threading.Event()
 
@@ -0,0 +1,64 @@
+#include "ln/Arena.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+
+TEST_CASE("ln::MonotonicArena bumps and aligns", "[ln::MonotonicArena]") {
+    alignas(std::max_align_t) std::array<std::byte, 64> storage{};
+    ln::MonotonicArena arena{storage};
+
+    REQUIRE(arena.capacity() == 64);
+    void *a = arena.allocate(3, 1);
+    REQUIRE(a == storage.data());
+    REQUIRE(arena.get_used_space() == 3);
+
+    void *b = arena.allocate(8, 8);
+    REQUIRE(b == storage.data() + 8);
+    REQUIRE(arena.get_used_space() == 16);
+
+    auto words = arena.allocate<std::uint32_t>(4);
+    REQUIRE(words.size() == 4);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(words.data()) % alignof(std::uint32_t) == 0);
+    REQUIRE(arena.get_used_space() == 32);
+}
+
+TEST_CASE("ln::MonotonicArena fails without side effects when full", "[ln::MonotonicArena]") {
+    alignas(std::max_align_t) std::array<std::byte, 32> storage{};
+    ln::MonotonicArena arena{storage};
+
+    REQUIRE(arena.allocate<char>(30).size() == 30);
+    REQUIRE(arena.allocate(4, 1) == nullptr);
+    REQUIRE(arena.allocate(1, 16) == nullptr);
+    REQUIRE(arena.allocate<std::uint64_t>(SIZE_MAX / 4).empty());
+    REQUIRE(arena.get_used_space() == 30);
+    REQUIRE(arena.allocate(2, 1) != nullptr);
+    REQUIRE(arena.get_used_space() == 32);
+}
+
+TEST_CASE("ln::MonotonicArena reset and rewind", "[ln::MonotonicArena]") {
+    alignas(std::max_align_t) std::array<std::byte, 32> storage{};
+    ln::MonotonicArena arena{storage};
+
+    (void)arena.allocate<char>(10);
+    const auto mark = arena.get_used_space();
+    auto nested = arena.allocate<char>(20);
+    REQUIRE(nested.size() == 20);
+    arena.rewind(mark);
+    REQUIRE(arena.get_used_space() == 10);
+    REQUIRE(arena.allocate<char>(20).data() == nested.data());
+
+    arena.rewind(31); // never grows
+    REQUIRE(arena.get_used_space() == 30);
+    arena.reset();
+    REQUIRE(arena.get_used_space() == 0);
+    REQUIRE(arena.get_peak_used_space() == 30);
+}
+
+TEST_CASE("ln::MonotonicArena without storage", "[ln::MonotonicArena]") {
+    ln::MonotonicArena arena{};
+    REQUIRE(arena.allocate(1) == nullptr);
+    REQUIRE(arena.allocate<char>(1).empty());
+    REQUIRE(arena.allocate<char>(0).empty());
+}
@@ -0,0 +1,56 @@
+#include "ln/BipBuffer.hpp"
+#include "ln/RingBuffer.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <numeric>
+
+namespace {
+
+constexpr std::size_t bench_capacity = 4096;
+constexpr std::size_t frame_count = 1024;
+
+/**
+ * @brief Stand-in for a consumer needing a contiguous frame, e.g. a DMA
+ * transmit or a parser.
+ */
+std::uint32_t process_frame(std::span<const std::uint8_t> frame) {
+    return std::accumulate(frame.begin(), frame.end(), std::uint32_t{0});
+}
+
+std::size_t frame_size_of(std::size_t i) { return 16 + (i * 37) % 200; }
+
+} // namespace
+
+TEST_CASE("ln::BipBuffer vs RingBuffer with copy-out", "[benchmark][ln::BipBuffer]") {
+    BENCHMARK("RingBuffer push + pop(std::span) copy-out") {
+        static ln::RingBuffer<std::uint8_t, bench_capacity> rb{};
+        static std::array<std::uint8_t, 256> frame{};
+        static std::array<std::uint8_t, 256> copy_out{};
+        std::uint32_t sum = 0;
+        for (std::size_t i = 0; i < frame_count; ++i) {
+            const auto size = frame_size_of(i);
+            (void)rb.push(std::span<const std::uint8_t>{frame}.first(size));
+            const auto popped = rb.pop(std::span{copy_out}.first(size));
+            sum += process_frame(std::span{copy_out}.first(popped));
+        }
+        return sum;
+    };
+
+    BENCHMARK("BipBuffer reserve/commit + readable_span/consume") {
+        static ln::BipBuffer<std::uint8_t, bench_capacity> bb{};
+        std::uint32_t sum = 0;
+        for (std::size_t i = 0; i < frame_count; ++i) {
+            const auto size = frame_size_of(i);
+            auto region = bb.reserve(size);
+            std::fill(region.begin(), region.end(), std::uint8_t{0});
+            (void)bb.commit(region.size());
+            auto data = bb.readable_span();
+            sum += process_frame(data);
+            (void)bb.consume(data.size());
+        }
+        return sum;
+    };
+}
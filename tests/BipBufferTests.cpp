@@ -0,0 +1,140 @@
+#include "ln/BipBuffer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+
+TEST_CASE("ln::BipBufferView basic reserve/commit/read/consume", "[ln::BipBufferView]") {
+    std::array<int, 8> storage{};
+    ln::BipBufferView<int> bb(storage);
+
+    REQUIRE(bb.empty());
+    REQUIRE(bb.capacity() == 8);
+    REQUIRE(bb.readable_span().empty());
+
+    auto region = bb.reserve(3);
+    REQUIRE(region.size() == 3);
+    region[0] = 1;
+    region[1] = 2;
+    region[2] = 3;
+    REQUIRE(bb.empty()); // nothing visible until committed
+    REQUIRE(bb.commit(3));
+    REQUIRE(bb.size() == 3);
+
+    auto data = bb.readable_span();
+    REQUIRE(data.size() == 3);
+    REQUIRE(data[0] == 1);
+    REQUIRE(data[2] == 3);
+
+    REQUIRE(bb.consume(3));
+    REQUIRE(bb.empty());
+}
+
+TEST_CASE("ln::BipBuffer commit validates reservation", "[ln::BipBuffer]") {
+    ln::BipBuffer<int, 8> bb{};
+
+    REQUIRE_FALSE(bb.commit(1)); // nothing reserved
+
+    REQUIRE(bb.reserve(4).size() == 4);
+    REQUIRE_FALSE(bb.commit(5));
+    REQUIRE(bb.commit(2)); // partial commit releases the rest
+    REQUIRE(bb.size() == 2);
+    REQUIRE_FALSE(bb.commit(1));
+
+    REQUIRE(bb.reserve(2).size() == 2);
+    REQUIRE(bb.commit(0)); // cancel
+    REQUIRE(bb.size() == 2);
+
+    REQUIRE_FALSE(bb.consume(3));
+}
+
+TEST_CASE("ln::BipBuffer never splits a reservation across the end", "[ln::BipBuffer]") {
+    ln::BipBuffer<int, 8> bb{};
+
+    REQUIRE(bb.reserve(6).size() == 6);
+    REQUIRE(bb.commit(6));
+    REQUIRE(bb.consume(4)); // A = [4, 6)
+
+    REQUIRE(bb.reserve(5).empty()); // 2 free at the end, 4 at the beginning
+
+    auto region = bb.reserve(4); // goes to B at the beginning
+    REQUIRE(region.data() == bb.readable_span().data() - 4);
+    std::fill(region.begin(), region.end(), 7);
+    REQUIRE(bb.commit(4));
+    REQUIRE(bb.size() == 6);
+
+    REQUIRE(bb.reserve(1).empty()); // B is adjacent to A, no room left
+    REQUIRE(bb.readable_span().size() == 2);
+    REQUIRE(bb.consume(2));
+
+    // B became A
+    auto data = bb.readable_span();
+    REQUIRE(data.size() == 4);
+    REQUIRE(std::ranges::all_of(data, [](int v) { return v == 7; }));
+    REQUIRE(bb.reserve(4).size() == 4);
+}
+
+TEST_CASE("ln::BipBuffer pending reservation survives draining", "[ln::BipBuffer]") {
+    ln::BipBuffer<int, 8> bb{};
+
+    REQUIRE(bb.reserve(6).size() == 6);
+    REQUIRE(bb.commit(6));
+    REQUIRE(bb.consume(3));
+
+    auto region = bb.reserve(3); // in B
+    REQUIRE(region.size() == 3);
+    region[0] = 42;
+    REQUIRE(bb.consume(3)); // A drained while B reservation is pending
+    REQUIRE(bb.empty());
+    REQUIRE(bb.commit(1));
+
+    auto data = bb.readable_span();
+    REQUIRE(data.size() == 1);
+    REQUIRE(data[0] == 42);
+}
+
+TEST_CASE("ln::BipBuffer::clear resets state", "[ln::BipBuffer]") {
+    ln::BipBuffer<int, 4> bb{};
+
+    REQUIRE(bb.reserve(3).size() == 3);
+    REQUIRE(bb.commit(3));
+    bb.clear();
+    REQUIRE(bb.empty());
+    REQUIRE(bb.reserve(4).size() == 4);
+}
+
+TEST_CASE("ln::BipBuffer preserves frame order under random traffic", "[ln::BipBuffer]") {
+    ln::BipBuffer<std::uint8_t, 64> bb{};
+    std::deque<std::uint8_t> model;
+
+    std::srand(42);
+    std::uint8_t next = 0;
+    for (int step = 0; step < 10000; ++step) {
+        if (std::rand() % 2) {
+            const auto frame_size = static_cast<size_t>(1 + std::rand() % 16);
+            auto region = bb.reserve(frame_size);
+            if (region.empty()) {
+                continue;
+            }
+            REQUIRE(region.size() == frame_size);
+            for (auto &v : region) {
+                v = next;
+                model.push_back(next++);
+            }
+            REQUIRE(bb.commit(frame_size));
+        }
+        else {
+            auto data = bb.readable_span();
+            const auto n = data.empty() ? 0 : static_cast<size_t>(1 + std::rand() % data.size());
+            for (size_t i = 0; i < n; ++i) {
+                REQUIRE(data[i] == model.front());
+                model.pop_front();
+            }
+            REQUIRE(bb.consume(n));
+        }
+        REQUIRE(bb.size() == model.size());
+    }
+}
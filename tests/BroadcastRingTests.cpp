@@ -0,0 +1,192 @@
+#include "ln/BroadcastRing.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+TEST_CASE("ln::BroadcastRing every reader sees the whole stream", "[ln::BroadcastRing]") {
+    ln::BroadcastRing<int, 8> ring{};
+    ln::BroadcastRing<int, 8>::Reader uart{ring};
+    ln::BroadcastRing<int, 8>::Reader flash{ring};
+
+    const std::array<int, 5> data{1, 2, 3, 4, 5};
+    ring.push(data);
+    REQUIRE(ring.sequence() == 5);
+    REQUIRE(uart.available() == 5);
+
+    std::array<int, 8> out{};
+    auto result = uart.read(std::span{out}.first(3));
+    REQUIRE(result.count == 3);
+    REQUIRE(result.lost == 0);
+    REQUIRE(out[0] == 1);
+    REQUIRE(out[2] == 3);
+
+    result = flash.read(out);
+    REQUIRE(result.count == 5);
+    REQUIRE(out[4] == 5);
+    REQUIRE(flash.available() == 0);
+
+    result = uart.read(out);
+    REQUIRE(result.count == 2);
+    REQUIRE(out[0] == 4);
+    REQUIRE(uart.sequence() == 5);
+}
+
+TEST_CASE("ln::BroadcastRing reader start position", "[ln::BroadcastRing]") {
+    ln::BroadcastRing<int, 4> ring{};
+    for (int i = 0; i < 6; ++i) {
+        ring.push(i);
+    }
+
+    ln::BroadcastRing<int, 4>::Reader latest{ring};
+    ln::BroadcastRing<int, 4>::Reader oldest{ring, ln::BroadcastRing<int, 4>::Reader::Start::oldest};
+    REQUIRE(latest.available() == 0);
+    REQUIRE(oldest.available() == 4);
+
+    std::array<int, 4> out{};
+    REQUIRE(oldest.read(out).count == 4);
+    REQUIRE(out == std::array<int, 4>{2, 3, 4, 5});
+    REQUIRE(oldest.get_lost_count() == 0);
+}
+
+TEST_CASE("ln::BroadcastRing reports exact overrun", "[ln::BroadcastRing]") {
+    ln::BroadcastRing<int, 4> ring{};
+    ln::BroadcastRing<int, 4>::Reader slow{ring};
+    ln::BroadcastRing<int, 4>::Reader fast{ring};
+
+    std::array<int, 4> out{};
+    for (int i = 0; i < 10; ++i) {
+        ring.push(i);
+        REQUIRE(fast.read(out).count == 1);
+    }
+    REQUIRE(fast.get_lost_count() == 0);
+
+    REQUIRE(slow.available() == 4);
+    auto result = slow.read(std::span{out}.first(2));
+    REQUIRE(result.lost == 6);
+    REQUIRE(result.count == 2);
+    REQUIRE(out[0] == 6);
+    REQUIRE(out[1] == 7);
+    result = slow.read(out);
+    REQUIRE(result.lost == 0);
+    REQUIRE(result.count == 2);
+    REQUIRE(slow.get_lost_count() == 6);
+}
+
+TEST_CASE("ln::BroadcastRing push longer than capacity", "[ln::BroadcastRing]") {
+    ln::BroadcastRing<int, 4> ring{};
+    ln::BroadcastRing<int, 4>::Reader reader{ring};
+
+    std::array<int, 7> data{};
+    std::iota(data.begin(), data.end(), 0);
+    ring.push(data);
+    REQUIRE(ring.sequence() == 7);
+
+    std::array<int, 8> out{};
+    auto result = reader.read(out);
+    REQUIRE(result.lost == 3);
+    REQUIRE(result.count == 4);
+    REQUIRE(out[0] == 3);
+    REQUIRE(out[3] == 6);
+}
+
+TEST_CASE("ln::BroadcastRing concurrent writer and readers", "[ln::BroadcastRing][threads]") {
+    static constexpr std::uint32_t total = 200'000;
+    ln::BroadcastRing<std::uint32_t, 64> ring{};
+    using Reader = ln::BroadcastRing<std::uint32_t, 64>::Reader;
+
+    auto consume = [](Reader &reader, bool &consistent) {
+        std::array<std::uint32_t, 16> out{};
+        std::uint32_t expected = 0;
+        while (expected < total) {
+            const auto result = reader.read(out);
+            expected += static_cast<std::uint32_t>(result.lost);
+            for (size_t i = 0; i < result.count; ++i) {
+                consistent = consistent && out[i] == expected++;
+            }
+            if (result.count == 0) {
+                std::this_thread::yield();
+            }
+        }
+        consistent = consistent && reader.sequence() == total;
+    };
+
+    Reader first{ring};
+    Reader second{ring};
+    bool first_consistent = true;
+    bool second_consistent = true;
+    std::thread first_thread{consume, std::ref(first), std::ref(first_consistent)};
+    std::thread second_thread{consume, std::ref(second), std::ref(second_consistent)};
+
+    for (std::uint32_t i = 0; i < total; ++i) {
+        ring.push(i);
+        if (i % 256 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    first_thread.join();
+    second_thread.join();
+
+    REQUIRE(first_consistent);
+    REQUIRE(second_consistent);
+}
+
+TEST_CASE("ln::BroadcastRing readers never see a torn element", "[ln::BroadcastRing][threads]") {
+    struct Sample {
+        std::uint32_t sequence;
+        std::array<std::uint32_t, 3> copies;
+    };
+    static constexpr std::uint32_t total = 100'000;
+    ln::BroadcastRing<Sample, 16> ring{};
+    using Reader = ln::BroadcastRing<Sample, 16>::Reader;
+    std::atomic<std::uint32_t> torn{0};
+
+    auto consume = [&](Reader &reader) {
+        std::array<Sample, 4> out{};
+        while (reader.sequence() < total) {
+            const auto result = reader.read(out);
+            for (size_t i = 0; i < result.count; ++i) {
+                for (const std::uint32_t copy : out[i].copies) {
+                    if (copy != out[i].sequence) {
+                        torn.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+    };
+    // readers lag behind a small ring, so the writer keeps overwriting what they copy
+    Reader first{ring};
+    Reader second{ring};
+    std::thread first_thread{consume, std::ref(first)};
+    std::thread second_thread{consume, std::ref(second)};
+    for (std::uint32_t i = 0; i < total; ++i) {
+        ring.push(Sample{i, {i, i, i}});
+    }
+    first_thread.join();
+    second_thread.join();
+
+    REQUIRE(torn == 0);
+}
+
+TEST_CASE("ln::BroadcastRing copies elements with no word alignment", "[ln::BroadcastRing]") {
+    struct Rgb {
+        std::uint8_t r, g, b;
+    };
+    ln::BroadcastRing<Rgb, 4> ring{};
+    ln::BroadcastRing<Rgb, 4>::Reader reader{ring};
+    const std::array<Rgb, 3> colors{{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}};
+    ring.push(colors);
+    std::array<Rgb, 4> out{};
+    REQUIRE(reader.read(out).count == 3);
+    REQUIRE(out[1].g == 5);
+    REQUIRE(out[2].b == 9);
+}
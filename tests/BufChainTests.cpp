@@ -0,0 +1,176 @@
+#include "ln/BufChain.hpp"
+#include "ln/stream.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <span>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+namespace {
+
+std::vector<std::byte> make_bytes(size_t size, unsigned first = 0) {
+    std::vector<std::byte> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<std::byte>(first + i);
+    }
+    return bytes;
+}
+
+std::vector<std::byte> contents(const ln::BufChain &chain) {
+    std::vector<std::byte> bytes(chain.size());
+    REQUIRE(chain.gather(bytes) == chain.size());
+    return bytes;
+}
+
+} // namespace
+
+TEST_CASE("ln::BufChain copies data into pool segments", "[ln::BufChain]") {
+    ln::StaticBufPool<16, 8> pool{};
+    const auto data = make_bytes(40);
+    auto chain = ln::BufChain::copy_of(pool, data);
+
+    REQUIRE(chain.size() == 40);
+    REQUIRE(chain.get_segment_count() == 3);
+    REQUIRE(pool.get_segment_usage().used == 3);
+    REQUIRE(contents(chain) == data);
+
+    std::vector<size_t> segment_sizes;
+    for (std::span<const std::byte> segment : chain.segments()) {
+        segment_sizes.push_back(segment.size());
+    }
+    REQUIRE(segment_sizes == std::vector<size_t>{16, 16, 8});
+
+    // appending fills the last segment before taking another
+    const auto more = make_bytes(10, 40);
+    REQUIRE(chain.append(more));
+    REQUIRE(chain.get_segment_count() == 4);
+    REQUIRE(contents(chain) == make_bytes(50));
+
+    chain.clear();
+    REQUIRE(chain.empty());
+    REQUIRE(pool.get_segment_usage().used == 0);
+    REQUIRE(pool.get_link_usage().used == 0);
+}
+
+TEST_CASE("ln::BufChain allocation is all or nothing", "[ln::BufChain]") {
+    ln::StaticBufPool<16, 4> pool{};
+    auto chain = ln::BufChain::allocate(pool, 40);
+    REQUIRE(chain.size() == 40);
+    std::byte fill{1};
+    for (std::span<std::byte> segment : chain.writable_segments()) {
+        std::fill(segment.begin(), segment.end(), fill);
+        fill = static_cast<std::byte>(static_cast<unsigned>(fill) + 1);
+    }
+    std::array<std::byte, 3> straddling{};
+    REQUIRE(chain.gather(straddling, 15) == 3);
+    REQUIRE(straddling == std::array{std::byte{1}, std::byte{2}, std::byte{2}});
+
+    // 8 bytes of room left in the last segment and 1 free segment: 24 fit, 25 do not
+    REQUIRE_FALSE(chain.append(make_bytes(25)));
+    REQUIRE(chain.size() == 40);
+    REQUIRE(chain.get_segment_count() == 3);
+    REQUIRE(pool.get_segment_usage().used == 3);
+    REQUIRE(chain.append(make_bytes(24)));
+    REQUIRE(chain.size() == 64);
+
+    auto failed = ln::BufChain::allocate(pool, 1);
+    REQUIRE(failed.empty());
+    REQUIRE(pool.get_segment_usage().failed == 2);
+}
+
+TEST_CASE("ln::BufChain shares segments by reference", "[ln::BufChain]") {
+    ln::StaticBufPool<16, 4, 16> pool{};
+    const auto data = make_bytes(20);
+    auto chain = ln::BufChain::copy_of(pool, data);
+    auto shared = chain.share();
+    REQUIRE(contents(shared) == data);
+    REQUIRE(pool.get_segment_usage().used == 2);
+    REQUIRE(pool.get_link_usage().used == 4);
+
+    // the shared last segment is not written into, a new one is taken
+    REQUIRE(chain.append(make_bytes(4, 20)));
+    REQUIRE(pool.get_segment_usage().used == 3);
+    REQUIRE(shared.size() == 20);
+    REQUIRE(contents(chain) == make_bytes(24));
+
+    chain.clear();
+    REQUIRE(pool.get_segment_usage().used == 2);
+    REQUIRE(contents(shared) == data);
+    shared = ln::BufChain{};
+    REQUIRE(pool.get_segment_usage().used == 0);
+    REQUIRE(pool.get_link_usage().used == 0);
+}
+
+TEST_CASE("ln::BufChain splits, appends and consumes without copying", "[ln::BufChain]") {
+    ln::StaticBufPool<16, 4, 16> pool{};
+    const auto data = make_bytes(40);
+
+    SECTION("split anywhere") {
+        for (size_t offset = 0; offset <= data.size(); ++offset) {
+            auto chain = ln::BufChain::copy_of(pool, data);
+            ln::BufChain tail{};
+            REQUIRE(chain.split(offset, tail));
+            REQUIRE(chain.size() == offset);
+            REQUIRE(tail.size() == data.size() - offset);
+            REQUIRE(contents(chain) == std::vector(data.begin(), data.begin() + offset));
+            REQUIRE(contents(tail) == std::vector(data.begin() + offset, data.end()));
+
+            // and join them back in O(1)
+            chain.append(std::move(tail));
+            REQUIRE(tail.empty());
+            REQUIRE(contents(chain) == data);
+            REQUIRE(pool.get_segment_usage().used == 3);
+        }
+        ln::BufChain tail{};
+        auto chain = ln::BufChain::copy_of(pool, data);
+        REQUIRE_FALSE(chain.split(41, tail));
+    }
+
+    SECTION("consume from the front") {
+        auto chain = ln::BufChain::copy_of(pool, data);
+        chain.consume(5);
+        REQUIRE(contents(chain) == std::vector(data.begin() + 5, data.end()));
+        chain.consume(11);
+        REQUIRE(chain.get_segment_count() == 2);
+        REQUIRE(pool.get_segment_usage().used == 2);
+        chain.consume(100);
+        REQUIRE(chain.empty());
+        REQUIRE(pool.get_segment_usage().used == 0);
+    }
+
+    SECTION("append into an empty chain") {
+        ln::BufChain chain{};
+        chain.append(ln::BufChain::copy_of(pool, data));
+        REQUIRE(chain.get_pool() == &pool);
+        REQUIRE(contents(chain) == data);
+    }
+
+    REQUIRE(pool.get_segment_usage().used == 0);
+    REQUIRE(pool.get_link_usage().used == 0);
+}
+
+TEST_CASE("ln::OutStream puts a BufChain segment by segment", "[ln::BufChain]") {
+    struct Recorder : ln::OutStream<std::byte> {
+        using ln::OutStream<std::byte>::put;
+        void put(std::span<const std::byte> span) override {
+            this->bytes.insert(this->bytes.end(), span.begin(), span.end());
+            ++this->puts;
+        }
+        std::vector<std::byte> bytes;
+        int puts = 0;
+    };
+
+    ln::StaticBufPool<16, 4> pool{};
+    const auto data = make_bytes(40);
+    const auto chain = ln::BufChain::copy_of(pool, data);
+    Recorder recorder{};
+    recorder.put(chain);
+    REQUIRE(recorder.bytes == data);
+    REQUIRE(recorder.puts == 3);
+}
@@ -0,0 +1,262 @@
+#include "ln/coroutine.hpp"
+#include "ln/SpscRingBuffer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// the test drives run_once() and the clock by hand
+class ManualScheduler : public ln::co::Scheduler {
+public:
+    ManualScheduler() : Scheduler{frames} {}
+
+    std::uint32_t time = 0;
+    int notify_count = 0;
+
+protected:
+    std::uint32_t ll_now() override { return this->time; }
+    void ll_wait(std::uint32_t /*timeout_ms*/) override {}
+    void ll_notify() override { ++this->notify_count; }
+
+private:
+    ln::co::FramePool<256, 8> frames;
+};
+
+// blocks on a condition variable like a task on its notification
+class ThreadScheduler : public ln::co::Scheduler {
+public:
+    ThreadScheduler() : Scheduler{frames} {}
+
+    void run_until_idle() {
+        (void)this->run_once();
+        while (this->get_job_count() > 0) {
+            this->ll_wait(this->get_wait_timeout());
+            (void)this->run_once();
+        }
+    }
+
+protected:
+    std::uint32_t ll_now() override {
+        const auto elapsed = std::chrono::steady_clock::now() - this->start;
+        return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+    }
+
+    void ll_wait(std::uint32_t timeout_ms) override {
+        std::unique_lock lock{this->mutex};
+        const auto notified = [this] { return this->notified; };
+        if (timeout_ms == forever) {
+            this->condition.wait(lock, notified);
+        }
+        else {
+            this->condition.wait_for(lock, std::chrono::milliseconds{timeout_ms}, notified);
+        }
+        this->notified = false;
+    }
+
+    void ll_notify() override {
+        {
+            std::lock_guard lock{this->mutex};
+            this->notified = true;
+        }
+        this->condition.notify_one();
+    }
+
+private:
+    ln::co::FramePool<256, 8> frames;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool notified = false;
+};
+
+ln::co::Job record(ln::co::Scheduler & /*scheduler*/, std::vector<std::string> &log, std::string name, int steps) {
+    for (int i = 0; i < steps; ++i) {
+        log.push_back(name + std::to_string(i));
+        co_await ln::co::yield();
+    }
+}
+
+ln::co::Job tick(ln::co::Scheduler &scheduler, std::vector<std::uint32_t> &ticks, std::chrono::milliseconds period,
+                 int count) {
+    auto next = scheduler.now();
+    for (int i = 0; i < count; ++i) {
+        next += period;
+        co_await ln::co::sleep_until(next);
+        ticks.push_back(scheduler.now().count());
+    }
+}
+
+ln::co::Job nap(ln::co::Scheduler & /*scheduler*/, std::vector<int> &woken, int id, std::chrono::milliseconds duration) {
+    co_await ln::co::sleep_for(duration);
+    woken.push_back(id);
+}
+
+ln::co::Job take(ln::co::Scheduler & /*scheduler*/, ln::co::Semaphore &semaphore, int &taken, int count) {
+    for (int i = 0; i < count; ++i) {
+        co_await semaphore.take();
+        ++taken;
+    }
+}
+
+ln::co::Job drain(ln::co::Scheduler & /*scheduler*/, ln::SpscRingBufferView<std::uint32_t> &buffer,
+                  std::uint32_t count, bool &in_order) {
+    std::uint32_t expected = 0;
+    while (expected < count) {
+        co_await ln::co::wait_readable(buffer);
+        while (auto value = buffer.pop()) {
+            in_order = in_order && *value == expected;
+            ++expected;
+        }
+    }
+}
+
+ln::co::Job oversized(ln::co::Scheduler & /*scheduler*/) {
+    std::array<std::uint8_t, 1024> scratch{};
+    co_await ln::co::yield();
+    scratch[0] = 1;
+}
+
+} // namespace
+
+TEST_CASE("ln::co::Scheduler interleaves jobs at co_await points", "[ln::co]") {
+    ManualScheduler scheduler{};
+    std::vector<std::string> log;
+    REQUIRE(scheduler.spawn(record(scheduler, log, "a", 2)));
+    REQUIRE(scheduler.spawn(record(scheduler, log, "b", 3)));
+    REQUIRE(scheduler.get_job_count() == 2);
+    REQUIRE(log.empty());
+
+    while (scheduler.run_once() > 0) {
+    }
+    REQUIRE(log == std::vector<std::string>{"a0", "b0", "a1", "b1", "b2"});
+    REQUIRE(scheduler.get_job_count() == 0);
+    REQUIRE(scheduler.get_frame_usage().used == 0);
+    REQUIRE(scheduler.get_frame_usage().peak == 2);
+}
+
+TEST_CASE("ln::co::sleep_until runs periodic jobs without drift", "[ln::co]") {
+    ManualScheduler scheduler{};
+    std::vector<std::uint32_t> ticks;
+    scheduler.time = 1000;
+    REQUIRE(scheduler.spawn(tick(scheduler, ticks, 10ms, 3)));
+    REQUIRE(scheduler.run_once() == 1);
+    REQUIRE(scheduler.get_wait_timeout() == 10);
+
+    scheduler.time = 1009;
+    REQUIRE(scheduler.run_once() == 0);
+    REQUIRE(scheduler.get_wait_timeout() == 1);
+    scheduler.time = 1013; // late wakeup
+    REQUIRE(scheduler.run_once() == 1);
+    REQUIRE(scheduler.get_wait_timeout() == 7);
+    scheduler.time = 1020;
+    REQUIRE(scheduler.run_once() == 1);
+    scheduler.time = 1030;
+    REQUIRE(scheduler.run_once() == 1);
+    REQUIRE(ticks == std::vector<std::uint32_t>{1013, 1020, 1030});
+    REQUIRE(scheduler.get_job_count() == 0);
+    REQUIRE(scheduler.get_wait_timeout() == ln::co::Scheduler::forever);
+}
+
+TEST_CASE("ln::co::sleep_for orders sleepers by wake time across wrap-around", "[ln::co]") {
+    ManualScheduler scheduler{};
+    std::vector<int> woken;
+    scheduler.time = UINT32_MAX - 5;
+    REQUIRE(scheduler.spawn(nap(scheduler, woken, 1, 30ms)));
+    REQUIRE(scheduler.spawn(nap(scheduler, woken, 2, 10ms)));
+    REQUIRE(scheduler.spawn(nap(scheduler, woken, 3, 20ms)));
+    REQUIRE(scheduler.spawn(nap(scheduler, woken, 4, 10ms)));
+    REQUIRE(scheduler.run_once() == 4);
+
+    scheduler.time += 10;
+    REQUIRE(scheduler.run_once() == 2);
+    REQUIRE(woken == std::vector<int>{2, 4});
+    scheduler.time += 100;
+    REQUIRE(scheduler.run_once() == 2);
+    REQUIRE(woken == std::vector<int>{2, 4, 3, 1});
+}
+
+TEST_CASE("ln::co::Semaphore wakes waiting jobs", "[ln::co]") {
+    ManualScheduler scheduler{};
+    ln::co::Semaphore semaphore{scheduler, 1, 2};
+    int taken = 0;
+    REQUIRE(scheduler.spawn(take(scheduler, semaphore, taken, 3)));
+    REQUIRE(scheduler.run_once() == 1);
+    REQUIRE(taken == 1);
+    REQUIRE(scheduler.run_once() == 0);
+
+    REQUIRE(semaphore.give());
+    REQUIRE(semaphore.give());
+    REQUIRE_FALSE(semaphore.give());
+    REQUIRE(scheduler.notify_count == 2);
+    REQUIRE(scheduler.run_once() == 1);
+    REQUIRE(taken == 3);
+    REQUIRE(scheduler.get_job_count() == 0);
+    REQUIRE(semaphore.get_count() == 0);
+}
+
+TEST_CASE("ln::co::Scheduler rejects frames that do not fit the pool", "[ln::co]") {
+    ManualScheduler scheduler{};
+    REQUIRE_FALSE(scheduler.spawn(oversized(scheduler)));
+    REQUIRE(scheduler.get_job_count() == 0);
+
+    std::vector<int> woken;
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(scheduler.spawn(nap(scheduler, woken, i, 1ms)));
+    }
+    REQUIRE_FALSE(scheduler.spawn(nap(scheduler, woken, 8, 1ms)));
+    REQUIRE(scheduler.get_frame_usage().failed == 1);
+
+    // unspawned jobs give their frame back
+    {
+        ManualScheduler other{};
+        ln::co::Job job = nap(other, woken, 9, 1ms);
+        REQUIRE(job);
+        REQUIRE(other.get_frame_usage().used == 1);
+    }
+}
+
+TEST_CASE("ln::co jobs wait for a ring buffer filled by another thread", "[ln::co][threads]") {
+    static constexpr std::uint32_t item_count = 20'000;
+    ThreadScheduler scheduler{};
+    ln::SpscRingBuffer<std::uint32_t, 64> buffer{};
+    ln::co::Semaphore done{scheduler};
+    bool in_order = true;
+    int taken = 0;
+    REQUIRE(scheduler.spawn(drain(scheduler, buffer, item_count, in_order)));
+    REQUIRE(scheduler.spawn(take(scheduler, done, taken, 1)));
+
+    std::thread producer([&] {
+        for (std::uint32_t i = 0; i < item_count;) {
+            if (buffer.push(i)) {
+                ++i;
+            }
+            else {
+                // like an ISR that notifies once per burst
+                scheduler.notify();
+                std::this_thread::yield();
+            }
+        }
+        scheduler.notify();
+        done.give();
+    });
+    scheduler.run_until_idle();
+    producer.join();
+
+    REQUIRE(in_order);
+    REQUIRE(taken == 1);
+    REQUIRE(buffer.empty());
+}
@@ -0,0 +1,169 @@
+#include "ln/DeferredExecutor.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+namespace {
+
+// runs the workers by hand, with a clock the test advances
+class ManualExecutor : public ln::DeferredExecutor<2, 4> {
+public:
+    std::array<int, 2> notify_count{};
+    std::uint32_t now = 0;
+
+protected:
+    void ll_notify(size_t level) override { ++this->notify_count[level]; }
+    std::uint32_t ll_timestamp() override { return this->now; }
+};
+
+// one worker thread per level, woken like a task notification
+class ThreadExecutor : public ln::DeferredExecutor<2, 32> {
+public:
+    ThreadExecutor() {
+        for (size_t level = 0; level < this->get_level_count(); ++level) {
+            this->workers[level] = std::thread([this, level] { this->work(level); });
+        }
+    }
+
+    ~ThreadExecutor() override {
+        this->stopping = true;
+        for (size_t level = 0; level < this->get_level_count(); ++level) {
+            this->ll_notify(level);
+            this->workers[level].join();
+        }
+    }
+
+protected:
+    void ll_notify(size_t level) override {
+        {
+            std::lock_guard lock{this->mutex};
+            ++this->notifications[level];
+        }
+        this->condition.notify_all();
+    }
+
+    std::uint32_t ll_timestamp() override { return 0; }
+
+private:
+    void work(size_t level) {
+        while (true) {
+            {
+                std::unique_lock lock{this->mutex};
+                this->condition.wait(lock, [&] { return this->notifications[level] > 0; });
+                this->notifications[level] = 0;
+            }
+            this->run_pending(level);
+            if (this->stopping) {
+                return;
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::array<int, 2> notifications{};
+    std::atomic<bool> stopping{false};
+    std::array<std::thread, 2> workers;
+};
+
+} // namespace
+
+TEST_CASE("ln::DeferredExecutor runs posted work in order per level", "[ln::DeferredExecutor]") {
+    ManualExecutor executor{};
+    std::vector<int> ran;
+
+    REQUIRE(executor.post(0, [&ran] { ran.push_back(1); }));
+    REQUIRE(executor.post(1, [&ran] { ran.push_back(10); }));
+    REQUIRE(executor.post(0, [&ran] { ran.push_back(2); }));
+    REQUIRE(executor.notify_count == std::array<int, 2>{2, 1});
+    REQUIRE(ran.empty());
+
+    REQUIRE(executor.run_pending(1) == 1);
+    REQUIRE(executor.run_pending(0) == 2);
+    REQUIRE(ran == std::vector<int>{10, 1, 2});
+    REQUIRE(executor.run_pending(0) == 0);
+
+    const auto stats = executor.get_stats(0);
+    REQUIRE(stats.posted == 2);
+    REQUIRE(stats.executed == 2);
+    REQUIRE(stats.failed == 0);
+    REQUIRE(executor.get_usage().used == 0);
+}
+
+TEST_CASE("ln::DeferredExecutor measures latency", "[ln::DeferredExecutor]") {
+    ManualExecutor executor{};
+    executor.now = 100;
+    REQUIRE(executor.post(0, [] {}));
+    executor.now = 130;
+    REQUIRE(executor.post(0, [] {}));
+    executor.now = 150;
+    executor.run_pending(0);
+
+    auto stats = executor.get_stats(0);
+    REQUIRE(stats.max_latency == 50);
+    REQUIRE(stats.last_latency == 20);
+
+    // timestamps may wrap around
+    executor.now = UINT32_MAX - 4;
+    REQUIRE(executor.post(0, [] {}));
+    executor.now = 5;
+    executor.run_pending(0);
+    stats = executor.get_stats(0);
+    REQUIRE(stats.last_latency == 10);
+    REQUIRE(stats.max_latency == 50);
+}
+
+TEST_CASE("ln::DeferredExecutor drops work when the pool is exhausted", "[ln::DeferredExecutor]") {
+    ManualExecutor executor{};
+    auto resource = std::make_shared<int>(0);
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(executor.post(i % 2, [resource] { ++*resource; }));
+    }
+    REQUIRE_FALSE(executor.post(0, [resource] { ++*resource; }));
+    REQUIRE(resource.use_count() == 5);
+    REQUIRE(executor.get_stats(0).failed == 1);
+    REQUIRE(executor.get_usage().used == 4);
+
+    executor.run_pending(0);
+    executor.run_pending(1);
+    REQUIRE(*resource == 4);
+    REQUIRE(resource.use_count() == 1);
+    REQUIRE(executor.get_usage().peak == 4);
+}
+
+TEST_CASE("ln::DeferredExecutor concurrent posters", "[ln::DeferredExecutor][threads]") {
+    static constexpr int poster_count = 4;
+    static constexpr int posts_per_poster = 20'000;
+    std::atomic<int> executed{0};
+    std::atomic<int> dropped{0};
+    {
+        ThreadExecutor executor{};
+        std::vector<std::thread> posters;
+        for (int p = 0; p < poster_count; ++p) {
+            posters.emplace_back([&, p] {
+                for (int i = 0; i < posts_per_poster; ++i) {
+                    if (!executor.post(static_cast<size_t>(p % 2),
+                                       [&executed] { executed.fetch_add(1, std::memory_order_relaxed); })) {
+                        dropped.fetch_add(1, std::memory_order_relaxed);
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto &poster : posters) {
+            poster.join();
+        }
+    }
+    REQUIRE(executed + dropped == poster_count * posts_per_poster);
+}
@@ -0,0 +1,219 @@
+#include "ln/EventBus.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+#include <thread>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+namespace {
+
+class ManualBus : public ln::EventBus {
+public:
+    std::uint32_t now = 0;
+
+protected:
+    std::uint32_t ll_timestamp() override { return this->now; }
+};
+
+class ZeroBus : public ln::EventBus {
+protected:
+    std::uint32_t ll_timestamp() override { return 0; }
+};
+
+struct Frame {
+    std::uint32_t sequence;
+    std::array<std::uint32_t, 16> samples;
+};
+
+} // namespace
+
+TEST_CASE("ln::Topic delivers one message to every subscriber by reference", "[ln::EventBus]") {
+    ManualBus bus{};
+    ln::Topic<Frame, 4> topic{bus, "frame"};
+    int notified = 0;
+    ln::Subscriber<Frame> a{[&] { ++notified; }};
+    ln::Subscriber<Frame> b{};
+    topic.subscribe(a);
+    topic.subscribe(b);
+    REQUIRE_FALSE(a.has_message());
+    REQUIRE_FALSE(a.take());
+
+    REQUIRE(topic.emplace(Frame{7, {1, 2, 3}}));
+    REQUIRE(notified == 1);
+    REQUIRE(a.has_message());
+    auto from_a = a.take();
+    auto from_b = b.take();
+    REQUIRE(from_a);
+    REQUIRE(from_a->sequence == 7);
+    REQUIRE((*from_b).samples[2] == 3);
+    // both read the same slot
+    REQUIRE(&*from_a == &*from_b);
+    REQUIRE(topic.get_usage().used == 1);
+
+    from_a.reset();
+    REQUIRE(topic.get_usage().used == 1);
+    from_b = ln::MessageRef<Frame>{};
+    REQUIRE(topic.get_usage().used == 0);
+    REQUIRE(topic.get_stats().published == 1);
+}
+
+TEST_CASE("ln::Subscriber keeps only the newest message", "[ln::EventBus]") {
+    ManualBus bus{};
+    ln::Topic<int, 3> topic{bus, "counter"};
+    ln::Subscriber<int> subscriber{};
+    topic.subscribe(subscriber);
+
+    for (int i = 1; i <= 5; ++i) {
+        REQUIRE(topic.publish(i));
+    }
+    REQUIRE(topic.get_usage().used == 1);
+    auto latest = subscriber.take();
+    REQUIRE(*latest == 5);
+    REQUIRE_FALSE(subscriber.take());
+
+    auto stats = topic.get_stats();
+    REQUIRE(stats.published == 5);
+    REQUIRE(stats.overwritten == 4);
+
+    // one slot is held by the reader, one by the mailbox, one is free
+    REQUIRE(topic.publish(6));
+    REQUIRE(topic.publish(7));
+    REQUIRE(topic.get_usage().used == 2);
+    latest.reset();
+    REQUIRE(*subscriber.take() == 7);
+    REQUIRE(topic.get_usage().used == 0);
+}
+
+TEST_CASE("ln::Topic drops messages when its slots run out", "[ln::EventBus]") {
+    ManualBus bus{};
+    ln::Topic<int, 2> topic{bus, "tight"};
+    ln::Subscriber<int> a{};
+    ln::Subscriber<int> b{};
+    topic.subscribe(a);
+    topic.subscribe(b);
+
+    REQUIRE(topic.publish(1));
+    auto held = a.take();
+    REQUIRE(topic.publish(2));
+    // a reads 1, b reads 2 and 2 also waits in a's mailbox
+    auto also_held = b.take();
+    REQUIRE_FALSE(topic.publish(3));
+    REQUIRE(topic.get_stats().dropped == 1);
+    REQUIRE(topic.get_usage().failed == 1);
+
+    held.reset();
+    REQUIRE(topic.publish(3));
+    REQUIRE(*a.take() == 3);
+    REQUIRE(*b.take() == 3);
+}
+
+TEST_CASE("ln::Topic sized subscribers + 1 + publishers never drops", "[ln::EventBus]") {
+    ManualBus bus{};
+    SECTION("one slot short drops while a taken message is held") {
+        ln::Topic<int, 2> topic{bus, "short"};
+        ln::Subscriber<int> subscriber{};
+        topic.subscribe(subscriber);
+        REQUIRE(topic.publish(1));
+        auto held = subscriber.take();
+        REQUIRE(topic.publish(2));
+        // one slot held by the reader, one by the mailbox, none to build 3 in
+        REQUIRE_FALSE(topic.publish(3));
+    }
+    SECTION("enough slots") {
+        ln::Topic<int, 3> topic{bus, "sized"};
+        ln::Subscriber<int> subscriber{};
+        topic.subscribe(subscriber);
+        REQUIRE(topic.publish(1));
+        auto held = subscriber.take();
+        for (int i = 2; i <= 10; ++i) {
+            REQUIRE(topic.publish(i));
+        }
+        REQUIRE(*held == 1);
+        held = subscriber.take();
+        REQUIRE(*held == 10);
+        REQUIRE(topic.publish(11));
+        REQUIRE(topic.publish(12));
+        REQUIRE(topic.get_stats().dropped == 0);
+    }
+}
+
+TEST_CASE("ln::Topic measures publish to take latency", "[ln::EventBus]") {
+    ManualBus bus{};
+    ln::Topic<int, 2> first{bus, "first"};
+    ln::Topic<int, 2> second{bus, "second"};
+    ln::Subscriber<int> subscriber{};
+    first.subscribe(subscriber);
+
+    bus.now = 100;
+    REQUIRE(first.publish(1));
+    bus.now = 130;
+    (void)subscriber.take();
+    REQUIRE(first.publish(2));
+    bus.now = 135;
+    (void)subscriber.take();
+
+    const auto stats = first.get_stats();
+    REQUIRE(stats.last_latency == 5);
+    REQUIRE(stats.max_latency == 30);
+
+    // topics list themselves on their bus, newest first
+    REQUIRE(bus.get_first_topic() == &second);
+    REQUIRE(bus.get_first_topic()->get_next() == &first);
+    REQUIRE(bus.get_first_topic()->get_next()->get_next() == nullptr);
+    REQUIRE(std::string_view{first.get_name()} == "first");
+}
+
+TEST_CASE("ln::Topic publishes from another thread while subscribers take", "[ln::EventBus][threads]") {
+    static constexpr std::uint32_t message_count = 200'000;
+    ZeroBus bus{};
+    ln::Topic<Frame, 5> topic{bus, "stress"};
+    std::atomic<int> wakeups{0};
+    ln::Subscriber<Frame> a{[&] { wakeups.fetch_add(1, std::memory_order_relaxed); }};
+    ln::Subscriber<Frame> b{};
+    topic.subscribe(a);
+    topic.subscribe(b);
+    std::atomic<bool> done{false};
+    std::atomic<int> failed_publishes{0};
+
+    std::thread publisher([&] {
+        for (std::uint32_t i = 1; i <= message_count; ++i) {
+            Frame frame{i, {}};
+            frame.samples.fill(i);
+            // 2 subscribers + 1 mailbox + 1 publisher need 4 slots, so a slot is always free
+            if (!topic.publish(frame)) {
+                ++failed_publishes;
+            }
+        }
+        done = true;
+    });
+
+    auto consume = [&](ln::Subscriber<Frame> &subscriber) {
+        std::uint32_t last = 0;
+        bool consistent = true;
+        while (!done || subscriber.has_message()) {
+            if (auto frame = subscriber.take()) {
+                consistent = consistent && frame->sequence > last && frame->samples[15] == frame->sequence;
+                last = frame->sequence;
+            }
+        }
+        return consistent && last == message_count;
+    };
+    bool b_ok = false;
+    std::thread reader([&] { b_ok = consume(b); });
+    const bool a_ok = consume(a);
+    publisher.join();
+    reader.join();
+
+    REQUIRE(failed_publishes == 0);
+    REQUIRE(a_ok);
+    REQUIRE(b_ok);
+    REQUIRE(wakeups == static_cast<int>(message_count));
+    REQUIRE(topic.get_usage().used == 0);
+    REQUIRE(topic.get_stats().dropped == 0);
+}
@@ -0,0 +1,50 @@
+#include "ln/FillWatermark.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+
+TEST_CASE("ln::FillWatermark clamps its level to the capacity", "[ln::FillWatermark]") {
+    ln::FillWatermark watermark{8, 0};
+    REQUIRE(watermark.get_level() == 1);
+    (void)watermark.set_level(100, 0);
+    REQUIRE(watermark.get_level() == 8);
+    (void)watermark.set_level(5, 0);
+    REQUIRE(watermark.get_level() == 5);
+}
+
+TEST_CASE("ln::FillWatermark wakes once per crossing", "[ln::FillWatermark]") {
+    ln::FillWatermark watermark{16, 4};
+
+    // single element pushes: only the one reaching the level wakes
+    std::size_t wakeups = 0;
+    for (std::size_t size = 0; size < 10; ++size) {
+        wakeups += watermark.crossed(size, size + 1);
+    }
+    REQUIRE(wakeups == 1);
+
+    // a chunk jumping over the level wakes, one starting above it does not
+    REQUIRE(watermark.crossed(2, 9));
+    REQUIRE(watermark.crossed(3, 4));
+    REQUIRE_FALSE(watermark.crossed(4, 9));
+    REQUIRE_FALSE(watermark.crossed(1, 3));
+    REQUIRE_FALSE(watermark.crossed(3, 3));
+
+    // after the consumer drains, the next batch wakes again
+    REQUIRE(watermark.crossed(0, 4));
+}
+
+TEST_CASE("ln::FillWatermark lowering the level below the fill wakes", "[ln::FillWatermark]") {
+    ln::FillWatermark watermark{16, 8};
+    // 5 stored, waiting for 8: lowering to 4 gives no push to cross it
+    REQUIRE(watermark.set_level(4, 5));
+    REQUIRE(watermark.reached(5));
+
+    // already reached before, or still not reached: nothing to wake
+    REQUIRE_FALSE(watermark.set_level(2, 5));
+    REQUIRE_FALSE(watermark.set_level(10, 5));
+    REQUIRE_FALSE(watermark.set_level(12, 11));
+    // raising it does not wake either
+    REQUIRE_FALSE(watermark.set_level(16, 11));
+    REQUIRE(watermark.crossed(11, 16));
+}
@@ -0,0 +1,162 @@
+#include "ln/HeapTracker.hpp"
+#include "ln/heap_tracking.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+namespace {
+
+const void *const site_a = reinterpret_cast<const void *>(0x1000);
+const void *const site_b = reinterpret_cast<const void *>(0x2000);
+
+void *tracked_malloc(ln::HeapTracker &tracker, std::size_t size, const void *caller) {
+    return tracker.on_allocate(std::malloc(size + ln::HeapTracker::overhead), size, caller);
+}
+
+void tracked_free(ln::HeapTracker &tracker, void *pointer) { std::free(tracker.on_deallocate(pointer)); }
+
+[[gnu::noinline]] int *leaky_function() { return new int{42}; }
+
+} // namespace
+
+TEST_CASE("ln::HeapTracker attributes allocations to call sites", "[ln::HeapTracker]") {
+    ln::StaticHeapTracker<8> tracker{};
+
+    void *a1 = tracked_malloc(tracker, 100, site_a);
+    void *a2 = tracked_malloc(tracker, 50, site_a);
+    void *b1 = tracked_malloc(tracker, 400, site_b);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(a1) % alignof(std::max_align_t) == 0);
+    REQUIRE(ln::HeapTracker::get_size(a2) == 50);
+
+    auto totals = tracker.get_totals();
+    REQUIRE(totals.live_count == 3);
+    REQUIRE(totals.live_size == 550);
+    REQUIRE(totals.site_count == 2);
+
+    std::array<ln::HeapTracker::Site, 4> sites{};
+    REQUIRE(tracker.get_top_sites(sites) == 2);
+    REQUIRE(sites[0].caller == site_b);
+    REQUIRE(sites[0].live_size == 400);
+    REQUIRE(sites[1].caller == site_a);
+    REQUIRE(sites[1].live_count == 2);
+
+    tracked_free(tracker, b1);
+    tracked_free(tracker, a1);
+    tracked_free(tracker, nullptr);
+    totals = tracker.get_totals();
+    REQUIRE(totals.live_count == 1);
+    REQUIRE(totals.live_size == 50);
+    REQUIRE(totals.peak_size == 550);
+
+    REQUIRE(tracker.get_top_sites(sites) == 2);
+    REQUIRE(sites[0].caller == site_a);
+    REQUIRE(sites[0].peak_size == 150);
+    REQUIRE(sites[1].caller == site_b);
+    REQUIRE(sites[1].live_count == 0);
+    REQUIRE(sites[1].peak_size == 400);
+
+    tracker.reset_peaks();
+    REQUIRE(tracker.get_totals().peak_size == 50);
+    tracked_free(tracker, a2);
+}
+
+TEST_CASE("ln::HeapTracker orders by churn", "[ln::HeapTracker]") {
+    ln::StaticHeapTracker<8> tracker{};
+    void *held = tracked_malloc(tracker, 1000, site_a);
+    for (int i = 0; i < 10; ++i) {
+        tracked_free(tracker, tracked_malloc(tracker, 16, site_b));
+    }
+
+    std::array<ln::HeapTracker::Site, 1> top{};
+    REQUIRE(tracker.get_top_sites(top, ln::HeapTracker::Order::live_size) == 1);
+    REQUIRE(top[0].caller == site_a);
+    REQUIRE(tracker.get_top_sites(top, ln::HeapTracker::Order::allocation_count) == 1);
+    REQUIRE(top[0].caller == site_b);
+    REQUIRE(top[0].allocation_count == 10);
+    REQUIRE(top[0].live_count == 0);
+    tracked_free(tracker, held);
+}
+
+TEST_CASE("ln::HeapTracker table overflow", "[ln::HeapTracker]") {
+    ln::StaticHeapTracker<2> tracker{};
+    std::vector<void *> blocks;
+    for (std::uintptr_t caller = 1; caller <= 4; ++caller) {
+        blocks.push_back(tracked_malloc(tracker, 8, reinterpret_cast<const void *>(caller * 0x10)));
+    }
+    auto totals = tracker.get_totals();
+    REQUIRE(totals.site_count == 2);
+    REQUIRE(totals.untracked_count == 2);
+    REQUIRE(totals.live_count == 4);
+
+    for (void *block : blocks) {
+        tracked_free(tracker, block);
+    }
+    totals = tracker.get_totals();
+    REQUIRE(totals.live_count == 0);
+    REQUIRE(totals.live_size == 0);
+}
+
+TEST_CASE("ln::heap_tracking catches leaks and churn of operator new", "[ln::heap_tracking]") {
+    const auto before = ln::heap_tracking::get_totals();
+    int *leak = leaky_function();
+    const auto leaked = ln::heap_tracking::get_totals();
+    REQUIRE(leaked.live_count == before.live_count + 1);
+    REQUIRE(leaked.live_size == before.live_size + sizeof(int));
+
+    std::array<ln::HeapTracker::Site, 64> sites{};
+    const std::size_t count = ln::heap_tracking::get_top_sites(sites);
+    const auto end = sites.begin() + static_cast<std::ptrdiff_t>(count);
+    REQUIRE(std::any_of(sites.begin(), end, [](const auto &site) { return site.live_size == sizeof(int); }));
+    delete leak;
+
+    const auto churn_before = ln::heap_tracking::get_totals();
+    for (int i = 0; i < 100; ++i) {
+        const std::function<int()> fn = [big = std::array<int, 16>{}, i] { return big[0] + i; };
+        (void)std::make_shared<int>(fn());
+    }
+    const auto churn_after = ln::heap_tracking::get_totals();
+    REQUIRE(churn_after.live_count == churn_before.live_count);
+    REQUIRE(churn_after.live_size == churn_before.live_size);
+    REQUIRE(churn_after.allocation_count >= churn_before.allocation_count + 200);
+}
+
+TEST_CASE("ln::heap_tracking reallocate tracks a C allocator hook", "[ln::heap_tracking]") {
+    const void *const lua_site = reinterpret_cast<const void *>(0x4000);
+    const auto before = ln::heap_tracking::get_totals();
+
+    auto *text = static_cast<char *>(ln::heap_tracking::reallocate(nullptr, 0, 4, lua_site));
+    REQUIRE(text);
+    std::copy_n("abc", 4, text);
+    text = static_cast<char *>(ln::heap_tracking::reallocate(text, 4, 64, lua_site));
+    REQUIRE(std::string_view{text} == "abc");
+    auto during = ln::heap_tracking::get_totals();
+    REQUIRE(during.live_count == before.live_count + 1);
+    REQUIRE(during.live_size == before.live_size + 64);
+
+    std::array<ln::HeapTracker::Site, 64> sites{};
+    const std::size_t count = ln::heap_tracking::get_top_sites(sites);
+    const auto end = sites.begin() + static_cast<std::ptrdiff_t>(count);
+    const auto site = std::find_if(sites.begin(), end, [&](const auto &site) { return site.caller == lua_site; });
+    REQUIRE(site != end);
+    REQUIRE(site->allocation_count == 2);
+
+    REQUIRE(ln::heap_tracking::reallocate(text, 64, 8, lua_site) == text);
+    REQUIRE(std::string_view{text} == "abc");
+    during = ln::heap_tracking::get_totals();
+    REQUIRE(during.live_count == before.live_count + 1);
+    REQUIRE(during.live_size == before.live_size + 8);
+
+    REQUIRE(ln::heap_tracking::reallocate(text, 8, 0, lua_site) == nullptr);
+    const auto after = ln::heap_tracking::get_totals();
+    REQUIRE(after.live_count == before.live_count);
+    REQUIRE(after.live_size == before.live_size);
+}
@@ -0,0 +1,65 @@
+#include "ln/InplaceFunction.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+namespace {
+
+int add(int a, int b) { return a + b; }
+
+} // namespace
+
+TEST_CASE("ln::InplaceFunction invokes callables", "[ln::InplaceFunction]") {
+    ln::InplaceFunction<int(int, int)> fn{};
+    REQUIRE_FALSE(fn);
+
+    fn = add;
+    REQUIRE(fn);
+    REQUIRE(fn(2, 3) == 5);
+
+    int calls = 0;
+    fn = [&calls](int a, int b) {
+        ++calls;
+        return a * b;
+    };
+    REQUIRE(fn(2, 3) == 6);
+    REQUIRE(calls == 1);
+
+    fn = nullptr;
+    REQUIRE_FALSE(fn);
+}
+
+TEST_CASE("ln::InplaceFunction moves and destroys its callable", "[ln::InplaceFunction]") {
+    auto resource = std::make_shared<int>(7);
+    {
+        ln::InplaceFunction<int()> a{[resource] { return *resource; }};
+        REQUIRE(resource.use_count() == 2);
+
+        ln::InplaceFunction<int()> b{std::move(a)};
+        REQUIRE_FALSE(a);
+        REQUIRE(b() == 7);
+        REQUIRE(resource.use_count() == 2);
+
+        a = std::move(b);
+        REQUIRE(a() == 7);
+        a.reset();
+        REQUIRE(resource.use_count() == 1);
+
+        a = [resource] { return *resource + 1; };
+        REQUIRE(resource.use_count() == 2);
+    }
+    REQUIRE(resource.use_count() == 1);
+
+    ln::InplaceFunction<int(), 64> big{[payload = std::array<int, 8>{1, 2, 3}] { return payload[2]; }};
+    REQUIRE(big() == 3);
+
+    auto owned = std::make_unique<int>(9);
+    ln::InplaceFunction<int()> move_only{[owned = std::move(owned)] { return *owned; }};
+    REQUIRE(move_only() == 9);
+}
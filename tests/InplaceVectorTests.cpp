@@ -0,0 +1,102 @@
+#include "ln/inplace_vector.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+namespace {
+
+struct Counted {
+    static inline int alive = 0;
+    int value;
+    explicit Counted(int value) : value(value) { ++alive; }
+    Counted(const Counted &other) : value(other.value) { ++alive; }
+    Counted(Counted &&other) noexcept : value(other.value) { ++alive; }
+    Counted &operator=(const Counted &) = default;
+    Counted &operator=(Counted &&) noexcept = default;
+    ~Counted() { --alive; }
+};
+
+} // namespace
+
+TEST_CASE("ln::inplace_vector push, pop and access", "[ln::inplace_vector]") {
+    ln::inplace_vector<int, 4> v{};
+    REQUIRE(v.empty());
+    REQUIRE(v.capacity() == 4);
+
+    v.push_back(1);
+    v.emplace_back(2);
+    REQUIRE(v.try_push_back(3));
+    REQUIRE(v.try_emplace_back(4));
+    REQUIRE(v.full());
+    REQUIRE(v.try_push_back(5) == nullptr);
+    REQUIRE(v.front() == 1);
+    REQUIRE(v.back() == 4);
+    REQUIRE(v[2] == 3);
+    REQUIRE(std::vector<int>(v.rbegin(), v.rend()) == std::vector<int>{4, 3, 2, 1});
+
+    v.pop_back();
+    REQUIRE(v.size() == 3);
+    const std::span<const int> s = v;
+    REQUIRE(s.size() == 3);
+    REQUIRE(s.data() == v.data());
+}
+
+TEST_CASE("ln::inplace_vector insert and erase", "[ln::inplace_vector]") {
+    ln::inplace_vector<int, 6> v{1, 2, 3};
+    REQUIRE(*v.insert(v.begin(), 0) == 0);
+    REQUIRE(*v.emplace(v.begin() + 2, 9) == 9);
+    REQUIRE(v == ln::inplace_vector<int, 6>{0, 1, 9, 2, 3});
+
+    REQUIRE(*v.erase(v.begin() + 2) == 2);
+    REQUIRE(v == ln::inplace_vector<int, 6>{0, 1, 2, 3});
+    REQUIRE(v.erase(v.begin() + 1, v.begin() + 3) == v.begin() + 1);
+    REQUIRE(v == ln::inplace_vector<int, 6>{0, 3});
+
+    const std::array<int, 8> more{4, 5, 6, 7, 8, 9, 10, 11};
+    REQUIRE(v.try_append(more) == 4);
+    REQUIRE(v.full());
+    REQUIRE(v.insert(v.begin(), -1) == v.end());
+    REQUIRE(v.back() == 7);
+
+    v.resize(2);
+    REQUIRE(v.size() == 2);
+    v.resize(4);
+    REQUIRE(v == ln::inplace_vector<int, 6>{0, 3, 0, 0});
+}
+
+TEST_CASE("ln::inplace_vector element lifetimes", "[ln::inplace_vector]") {
+    {
+        ln::inplace_vector<Counted, 4> a{};
+        a.emplace_back(1);
+        a.emplace_back(2);
+        a.emplace_back(3);
+        REQUIRE(Counted::alive == 3);
+
+        a.erase(a.begin());
+        REQUIRE(Counted::alive == 2);
+        REQUIRE(a.front().value == 2);
+
+        ln::inplace_vector<Counted, 4> b{a};
+        REQUIRE(Counted::alive == 4);
+        ln::inplace_vector<Counted, 4> c{std::move(b)};
+        REQUIRE(b.empty());
+        REQUIRE(Counted::alive == 4);
+
+        a = c;
+        REQUIRE(Counted::alive == 4);
+        c.clear();
+        REQUIRE(Counted::alive == 2);
+    }
+    REQUIRE(Counted::alive == 0);
+
+    ln::inplace_vector<std::unique_ptr<std::string>, 2> owners{};
+    owners.push_back(std::make_unique<std::string>("owned"));
+    REQUIRE(*owners.front() == "owned");
+}
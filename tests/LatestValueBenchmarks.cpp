@@ -0,0 +1,128 @@
+#include "ln/SeqLock.hpp"
+#include "ln/TripleBuffer.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+constexpr std::uint32_t bench_read_count = 1 << 16;
+
+struct Frame {
+    std::uint32_t sequence;
+    std::array<std::uint32_t, 15> samples;
+};
+
+Frame make_frame(std::uint32_t sequence) {
+    Frame frame{sequence, {}};
+    frame.samples.fill(sequence);
+    return frame;
+}
+
+/// The baseline: a copy of the value behind a mutex.
+class MutexGuarded {
+public:
+    void store(const Frame &frame) {
+        std::scoped_lock lock(this->mutex);
+        this->frame = frame;
+    }
+
+    Frame load() {
+        std::scoped_lock lock(this->mutex);
+        return this->frame;
+    }
+
+private:
+    std::mutex mutex;
+    Frame frame{};
+};
+
+/// Runs a writer thread storing frames until reads returns, and sums what reads saw.
+template <typename Store, typename Reads> std::uint64_t with_writer(Store store, Reads reads) {
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (std::uint32_t i = 1; !done.load(std::memory_order_relaxed); ++i) {
+            store(make_frame(i));
+        }
+    });
+    const std::uint64_t sum = reads();
+    done = true;
+    writer.join();
+    return sum;
+}
+
+} // namespace
+
+TEST_CASE("ln::SeqLock and ln::TripleBuffer latest value exchange", "[benchmark][ln::SeqLock][ln::TripleBuffer]") {
+    BENCHMARK("mutex guarded copy store/load (single thread)") {
+        static MutexGuarded guarded{};
+        std::uint64_t sum = 0;
+        for (std::uint32_t i = 0; i < bench_read_count; ++i) {
+            guarded.store(make_frame(i));
+            sum += guarded.load().samples[7];
+        }
+        return sum;
+    };
+
+    BENCHMARK("SeqLock store/load (single thread)") {
+        static ln::SeqLock<Frame> lock{};
+        std::uint64_t sum = 0;
+        for (std::uint32_t i = 0; i < bench_read_count; ++i) {
+            lock.store(make_frame(i));
+            sum += lock.load().samples[7];
+        }
+        return sum;
+    };
+
+    BENCHMARK("TripleBuffer write/read (single thread)") {
+        static ln::TripleBuffer<Frame> buffer{};
+        std::uint64_t sum = 0;
+        for (std::uint32_t i = 0; i < bench_read_count; ++i) {
+            buffer.write(make_frame(i));
+            sum += buffer.read().samples[7];
+        }
+        return sum;
+    };
+
+    BENCHMARK("mutex guarded copy reads under a writer thread") {
+        static MutexGuarded guarded{};
+        return with_writer([&](const Frame &frame) { guarded.store(frame); },
+                           [&] {
+                               std::uint64_t sum = 0;
+                               for (std::uint32_t i = 0; i < bench_read_count; ++i) {
+                                   sum += guarded.load().samples[7];
+                               }
+                               return sum;
+                           });
+    };
+
+    BENCHMARK("SeqLock reads under a writer thread") {
+        static ln::SeqLock<Frame> lock{};
+        return with_writer([&](const Frame &frame) { lock.store(frame); },
+                           [&] {
+                               std::uint64_t sum = 0;
+                               for (std::uint32_t i = 0; i < bench_read_count; ++i) {
+                                   sum += lock.load().samples[7];
+                               }
+                               return sum;
+                           });
+    };
+
+    BENCHMARK("TripleBuffer reads under a writer thread") {
+        static ln::TripleBuffer<Frame> buffer{};
+        return with_writer([&](const Frame &frame) { buffer.write(frame); },
+                           [&] {
+                               std::uint64_t sum = 0;
+                               for (std::uint32_t i = 0; i < bench_read_count; ++i) {
+                                   sum += buffer.read().samples[7];
+                               }
+                               return sum;
+                           });
+    };
+}
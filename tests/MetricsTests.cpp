@@ -0,0 +1,134 @@
+#include "ln/metrics.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+ln::metrics::Counter test_counter{"test.counter"};
+ln::metrics::Gauge test_gauge{"test.gauge"};
+ln::metrics::Histogram<2, 8> test_histogram{"test.histogram"};
+
+} // namespace
+
+TEST_CASE("ln::metrics registers metrics statically", "[ln::metrics]") {
+    REQUIRE(ln::metrics::find("test.counter") == &test_counter);
+    REQUIRE(ln::metrics::find("test.gauge") == &test_gauge);
+    REQUIRE(ln::metrics::find("test.histogram") == &test_histogram);
+    REQUIRE(ln::metrics::find("test.missing") == nullptr);
+    REQUIRE(test_histogram.get_kind() == ln::metrics::Metric::Kind::histogram);
+
+    // function-local metrics join the registry when first reached, newest first
+    static ln::metrics::Counter late{"test.late"};
+    REQUIRE(ln::metrics::get_first() == &late);
+
+    int registered = 0;
+    for (auto *metric = ln::metrics::get_first(); metric; metric = metric->get_next()) {
+        registered += std::string_view{metric->get_name()}.starts_with("test.");
+    }
+    REQUIRE(registered >= 4);
+
+    test_counter.add();
+    test_counter.add(4);
+    REQUIRE(test_counter.get() == 5);
+    test_counter.reset();
+    REQUIRE(test_counter.get() == 0);
+
+    test_gauge.set(10);
+    test_gauge.add(-15);
+    REQUIRE(test_gauge.get() == -5);
+}
+
+TEST_CASE("ln::metrics::Histogram buckets are log-linear", "[ln::metrics]") {
+    static ln::metrics::Histogram<2, 8> histogram{"test.buckets"};
+    REQUIRE(histogram.bucket_count == 28);
+    REQUIRE(histogram.get_bucket_count() == 28);
+
+    // one bucket per value up to 2^(precision_bits + 1), then 4 per power of two
+    std::uint32_t expected_lower = 0;
+    for (size_t i = 0; i < histogram.get_bucket_count(); ++i) {
+        const auto bucket = histogram.get_bucket(i);
+        REQUIRE(bucket.lower == expected_lower);
+        REQUIRE(bucket.upper >= bucket.lower);
+        REQUIRE((bucket.upper - bucket.lower + 1) * 4 <= std::max<std::uint32_t>(bucket.lower, 4));
+        expected_lower = bucket.upper + 1;
+    }
+    REQUIRE(expected_lower == 256);
+    REQUIRE(histogram.get_bucket(8).lower == 8);
+    REQUIRE(histogram.get_bucket(8).upper == 9);
+    REQUIRE(histogram.get_bucket(27).lower == 224);
+
+    histogram.record(9);
+    histogram.record(8);
+    histogram.record(1000); // beyond range_bits, lands in the last bucket
+    REQUIRE(histogram.get_bucket(8).count == 2);
+    REQUIRE(histogram.get_bucket(27).count == 1);
+    REQUIRE(histogram.get_count() == 3);
+    REQUIRE(histogram.get_min() == 8);
+    REQUIRE(histogram.get_max() == 1000);
+
+    histogram.reset();
+    REQUIRE(histogram.get_count() == 0);
+    REQUIRE(histogram.get_min() == 0);
+    REQUIRE(histogram.get_max() == 0);
+    REQUIRE(histogram.get_quantile(500) == 0);
+}
+
+TEST_CASE("ln::metrics::Histogram quantiles are within the bucket precision", "[ln::metrics]") {
+    static ln::metrics::Histogram<3, 32> histogram{"test.quantiles"};
+    for (std::uint32_t value = 1; value <= 10'000; ++value) {
+        histogram.record(value);
+    }
+    auto within = [](std::uint32_t estimate, std::uint32_t exact) {
+        return estimate >= exact && estimate - exact <= exact / 8;
+    };
+    REQUIRE(within(histogram.get_quantile(500), 5'000));
+    REQUIRE(within(histogram.get_quantile(900), 9'000));
+    REQUIRE(within(histogram.get_quantile(999), 9'990));
+    REQUIRE(histogram.get_quantile(1000) == 10'000);
+    REQUIRE(histogram.get_quantile(0) == 1);
+
+    histogram.record(std::numeric_limits<std::uint32_t>::max());
+    const auto last = histogram.get_bucket(histogram.get_bucket_count() - 1);
+    REQUIRE(last.upper == std::numeric_limits<std::uint32_t>::max());
+    REQUIRE(last.count == 1);
+    REQUIRE(histogram.get_quantile(1000) == std::numeric_limits<std::uint32_t>::max());
+}
+
+TEST_CASE("ln::metrics updates are lock-free across threads", "[ln::metrics][threads]") {
+    static constexpr std::uint32_t per_thread = 100'000;
+    static constexpr int thread_count = 4;
+    // metrics are never unregistered, so they must outlive the test
+    static ln::metrics::Counter counter{"test.threaded_counter"};
+    static ln::metrics::Histogram<> histogram{"test.threaded_histogram"};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            for (std::uint32_t i = 0; i < per_thread; ++i) {
+                counter.add();
+                histogram.record(i * thread_count + static_cast<std::uint32_t>(t));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(counter.get() == per_thread * thread_count);
+    REQUIRE(histogram.get_count() == per_thread * thread_count);
+    std::uint64_t bucketed = 0;
+    for (size_t i = 0; i < histogram.get_bucket_count(); ++i) {
+        bucketed += histogram.get_bucket(i).count;
+    }
+    REQUIRE(bucketed == per_thread * thread_count);
+    REQUIRE(histogram.get_min() == 0);
+    REQUIRE(histogram.get_max() == per_thread * thread_count - 1);
+}
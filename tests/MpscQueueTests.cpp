@@ -0,0 +1,110 @@
+#include "ln/MpscQueue.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Item : ln::StaticForwardListNode<Item> {
+    std::uint32_t producer = 0;
+    std::uint32_t sequence = 0;
+};
+
+} // namespace
+
+TEST_CASE("ln::MpscQueue preserves FIFO order", "[ln::MpscQueue]") {
+    ln::MpscQueue<Item> queue{};
+    std::array<Item, 4> items{};
+    REQUIRE(queue.empty());
+    REQUIRE(queue.pop() == nullptr);
+
+    for (std::uint32_t i = 0; i < items.size(); ++i) {
+        items[i].sequence = i;
+        queue.push(items[i]);
+    }
+    REQUIRE_FALSE(queue.empty());
+    for (auto &item : items) {
+        REQUIRE(queue.pop() == &item);
+    }
+    REQUIRE(queue.empty());
+    REQUIRE(queue.pop() == nullptr);
+}
+
+TEST_CASE("ln::MpscQueue reuses nodes across empty transitions", "[ln::MpscQueue]") {
+    ln::MpscQueue<Item> queue{};
+    Item a{};
+    Item b{};
+    for (int round = 0; round < 10; ++round) {
+        queue.push(a);
+        REQUIRE(queue.pop() == &a);
+        REQUIRE(queue.empty());
+        REQUIRE(queue.pop() == nullptr);
+
+        queue.push(a);
+        queue.push(b);
+        REQUIRE(queue.pop() == &a);
+        queue.push(a);
+        REQUIRE(queue.pop() == &b);
+        REQUIRE(queue.pop() == &a);
+        REQUIRE(queue.pop() == nullptr);
+    }
+}
+
+TEST_CASE("ln::MpscQueue concurrent producers stress", "[ln::MpscQueue][threads]") {
+    static constexpr std::uint32_t producer_count = 4;
+    static constexpr std::uint32_t items_per_producer = 100'000;
+    static constexpr std::uint32_t nodes_per_producer = 64;
+    ln::MpscQueue<Item> queue{};
+
+    // each producer recycles a small set of nodes, taking one back only after
+    // the consumer has released it
+    std::vector<std::vector<Item>> nodes(producer_count, std::vector<Item>(nodes_per_producer));
+    std::vector<std::vector<std::atomic<bool>>> in_flight(producer_count);
+    for (auto &flags : in_flight) {
+        flags = std::vector<std::atomic<bool>>(nodes_per_producer);
+    }
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t p = 0; p < producer_count; ++p) {
+        producers.emplace_back([&, p] {
+            for (std::uint32_t i = 0; i < items_per_producer; ++i) {
+                const std::uint32_t slot = i % nodes_per_producer;
+                while (in_flight[p][slot].load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                in_flight[p][slot].store(true, std::memory_order_relaxed);
+                Item &item = nodes[p][slot];
+                item.producer = p;
+                item.sequence = i;
+                queue.push(item);
+            }
+        });
+    }
+
+    std::array<std::uint32_t, producer_count> expected{};
+    std::uint32_t received = 0;
+    bool in_order = true;
+    while (received < producer_count * items_per_producer) {
+        Item *item = queue.pop();
+        if (!item) {
+            std::this_thread::yield();
+            continue;
+        }
+        in_order = in_order && item->sequence == expected[item->producer];
+        ++expected[item->producer];
+        ++received;
+        in_flight[item->producer][item->sequence % nodes_per_producer].store(false, std::memory_order_release);
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    REQUIRE(in_order);
+    REQUIRE(queue.empty());
+    REQUIRE(queue.pop() == nullptr);
+}
@@ -0,0 +1,180 @@
+#include "ln/Pool.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <list>
+#include <map>
+#include <set>
+#include <thread>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+TEST_CASE("ln::BlockPool hands out every block exactly once", "[ln::BlockPool]") {
+    alignas(std::max_align_t) std::array<std::byte, 100> storage{};
+    ln::BlockPool pool{storage, 10};
+
+    REQUIRE(pool.get_block_size() == 10);
+    REQUIRE(pool.get_block_count() == 100 / ln::BlockPool::get_stride(10, alignof(std::max_align_t)));
+
+    std::set<void *> blocks;
+    for (size_t i = 0; i < pool.get_block_count(); ++i) {
+        void *block = pool.allocate();
+        REQUIRE(block != nullptr);
+        REQUIRE(pool.owns(block));
+        REQUIRE(reinterpret_cast<std::uintptr_t>(block) % alignof(std::max_align_t) == 0);
+        blocks.insert(block);
+    }
+    REQUIRE(blocks.size() == pool.get_block_count());
+    REQUIRE(pool.allocate() == nullptr);
+
+    for (void *block : blocks) {
+        pool.deallocate(block);
+    }
+    REQUIRE(pool.allocate() != nullptr);
+}
+
+TEST_CASE("ln::BlockPool usage report", "[ln::BlockPool]") {
+    alignas(std::max_align_t) std::array<std::byte, 64> storage{};
+    ln::BlockPool pool{storage, 16, 16};
+    REQUIRE(pool.get_block_count() == 4);
+
+    void *a = pool.allocate();
+    void *b = pool.allocate();
+    void *c = pool.allocate();
+    pool.deallocate(b);
+    pool.deallocate(nullptr);
+
+    auto usage = pool.get_usage();
+    REQUIRE(usage.used == 2);
+    REQUIRE(usage.peak == 3);
+    REQUIRE(usage.failed == 0);
+    REQUIRE(usage.total == 4);
+
+    void *d = pool.allocate();
+    void *e = pool.allocate();
+    REQUIRE(pool.allocate() == nullptr);
+    usage = pool.get_usage();
+    REQUIRE(usage.used == 4);
+    REQUIRE(usage.peak == 4);
+    REQUIRE(usage.failed == 1);
+
+    for (void *block : {a, c, d, e}) {
+        pool.deallocate(block);
+    }
+    REQUIRE(pool.get_usage().used == 0);
+}
+
+TEST_CASE("ln::BlockPool::owns rejects foreign and misaligned pointers", "[ln::BlockPool]") {
+    alignas(std::max_align_t) std::array<std::byte, 64> storage{};
+    ln::BlockPool pool{storage, 16, 16};
+    int foreign = 0;
+
+    REQUIRE_FALSE(pool.owns(&foreign));
+    REQUIRE_FALSE(pool.owns(storage.data() + 1));
+    REQUIRE(pool.owns(storage.data() + 16));
+}
+
+TEST_CASE("ln::Pool create/destroy", "[ln::Pool]") {
+    struct Object {
+        Object(int a, double b, int &live) : a(a), b(b), live(live) { ++live; }
+        ~Object() { --live; }
+        int a;
+        double b;
+        int &live;
+    };
+    int live = 0;
+    ln::Pool<Object, 2> pool{};
+
+    Object *first = pool.create(1, 2.5, live);
+    Object *second = pool.create(2, 3.5, live);
+    REQUIRE(first != nullptr);
+    REQUIRE(second != nullptr);
+    REQUIRE(pool.create(3, 0.0, live) == nullptr);
+    REQUIRE(live == 2);
+    REQUIRE(first->a == 1);
+    REQUIRE(second->b == 3.5);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(second) % alignof(Object) == 0);
+
+    pool.destroy(first);
+    REQUIRE(live == 1);
+    Object *third = pool.create(3, 4.5, live);
+    REQUIRE(third == first);
+    pool.destroy(third);
+    pool.destroy(second);
+    pool.destroy(nullptr);
+    REQUIRE(live == 0);
+    REQUIRE(pool.get_usage().used == 0);
+}
+
+TEST_CASE("ln::Pool small objects take at least one link", "[ln::Pool]") {
+    STATIC_REQUIRE(sizeof(ln::Pool<char, 8>) >= 8 * sizeof(std::uint32_t));
+    ln::Pool<char, 8> pool{};
+    REQUIRE(pool.get_block_count() == 8);
+}
+
+TEST_CASE("ln::PoolAllocator backs node-based containers", "[ln::PoolAllocator]") {
+    // block large enough for the list and map nodes of this standard library
+    ln::Pool<std::array<std::byte, 64>, 16> pool{};
+
+    {
+        std::list<int, ln::PoolAllocator<int>> list{ln::PoolAllocator<int>{pool}};
+        for (int i = 0; i < 8; ++i) {
+            list.push_back(i);
+        }
+        REQUIRE(pool.get_usage().used == 8);
+
+        std::map<int, int, std::less<>, ln::PoolAllocator<std::pair<const int, int>>> map{
+            ln::PoolAllocator<std::pair<const int, int>>{pool}};
+        map[1] = 10;
+        map[2] = 20;
+        REQUIRE(pool.get_usage().used == 10);
+        REQUIRE(map.at(2) == 20);
+        REQUIRE(list.back() == 7);
+    }
+    REQUIRE(pool.get_usage().used == 0);
+    REQUIRE(pool.get_usage().peak == 10);
+}
+
+TEST_CASE("ln::BlockPool concurrent allocate/deallocate", "[ln::BlockPool][threads]") {
+    static constexpr int thread_count = 4;
+    static constexpr int iterations = 50'000;
+    ln::Pool<std::uint64_t, 8> pool{};
+    std::atomic<bool> corrupted{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&pool, &corrupted, t] {
+            for (int i = 0; i < iterations; ++i) {
+                std::uint64_t *value = pool.create(static_cast<std::uint64_t>(t) << 32 | static_cast<unsigned>(i));
+                if (!value) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (i % 64 == 0) {
+                    std::this_thread::yield();
+                }
+                if (*value != (static_cast<std::uint64_t>(t) << 32 | static_cast<unsigned>(i))) {
+                    corrupted = true;
+                }
+                pool.destroy(value);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE_FALSE(corrupted);
+    const auto usage = pool.get_usage();
+    REQUIRE(usage.used == 0);
+    REQUIRE(usage.peak <= 8);
+    std::set<void *> blocks;
+    for (int i = 0; i < 8; ++i) {
+        blocks.insert(pool.allocate());
+    }
+    REQUIRE(blocks.size() == 8);
+    REQUIRE_FALSE(blocks.contains(nullptr));
+}
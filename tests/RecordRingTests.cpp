@@ -0,0 +1,199 @@
+#include "ln/RecordRing.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+namespace {
+
+std::span<const std::byte> as_bytes(std::string_view sv) { return std::as_bytes(std::span{sv}); }
+
+std::string_view as_string_view(std::span<const std::byte> bytes) {
+    return {reinterpret_cast<const char *>(bytes.data()), bytes.size()};
+}
+
+bool produce(ln::RecordRingView &ring, std::string_view message) {
+    auto record = ring.reserve(message.size());
+    if (record.size() != message.size()) {
+        return false;
+    }
+    std::ranges::copy(as_bytes(message), record.begin());
+    return ring.commit(record);
+}
+
+} // namespace
+
+TEST_CASE("ln::RecordRing basic reserve/commit/front/pop", "[ln::RecordRing]") {
+    ln::RecordRing<64> ring{};
+
+    REQUIRE(ring.capacity() == 64);
+    REQUIRE_FALSE(ring.front().has_value());
+    REQUIRE_FALSE(ring.pop());
+
+    REQUIRE(produce(ring, "hello"));
+    REQUIRE(produce(ring, "ring"));
+    REQUIRE(ring.get_used_space() == 16 + 16);
+
+    auto record = ring.front();
+    REQUIRE(record.has_value());
+    REQUIRE(as_string_view(*record) == "hello");
+    REQUIRE(ring.pop());
+    REQUIRE(as_string_view(*ring.front()) == "ring");
+    REQUIRE(ring.pop());
+    REQUIRE_FALSE(ring.front().has_value());
+    REQUIRE(ring.get_used_space() == 0);
+}
+
+TEST_CASE("ln::RecordRing uncommitted record is invisible", "[ln::RecordRing]") {
+    ln::RecordRing<64> ring{};
+
+    auto record = ring.reserve(4);
+    REQUIRE(record.size() == 4);
+    REQUIRE_FALSE(ring.front().has_value());
+    REQUIRE(ring.commit(record));
+    REQUIRE(ring.front().has_value());
+}
+
+TEST_CASE("ln::RecordRing commit of a shorter prefix", "[ln::RecordRing]") {
+    ln::RecordRing<64> ring{};
+
+    auto record = ring.reserve(16);
+    REQUIRE_FALSE(ring.commit(std::span<const std::byte>{record.data(), 17}));
+    std::ranges::copy(as_bytes("abc"), record.begin());
+    REQUIRE(ring.commit(record.first(3)));
+    REQUIRE(produce(ring, "next"));
+
+    REQUIRE(as_string_view(*ring.front()) == "abc");
+    REQUIRE(ring.pop());
+    REQUIRE(as_string_view(*ring.front()) == "next");
+}
+
+TEST_CASE("ln::RecordRing zero-size records", "[ln::RecordRing]") {
+    ln::RecordRing<32> ring{};
+
+    auto record = ring.reserve(0);
+    REQUIRE(ring.commit(record));
+    auto front = ring.front();
+    REQUIRE(front.has_value());
+    REQUIRE(front->empty());
+    REQUIRE(ring.pop());
+}
+
+TEST_CASE("ln::RecordRing rejects records that do not fit", "[ln::RecordRing]") {
+    ln::RecordRing<32> ring{};
+
+    REQUIRE(ring.max_record_size() == 24);
+    REQUIRE(ring.reserve(25).empty());
+    REQUIRE(produce(ring, "0123456789")); // 24 bytes used
+    REQUIRE(ring.reserve(1).empty());     // needs 16 bytes
+    REQUIRE(ring.reserve(0).data() != nullptr);
+    REQUIRE(ring.get_used_space() == 32);
+}
+
+TEST_CASE("ln::RecordRing skips padding at the wrap point", "[ln::RecordRing]") {
+    ln::RecordRing<64> ring{};
+
+    REQUIRE(produce(ring, std::string_view{"0123456789abcdef0123456789abcdef0123"})); // 48 bytes
+    REQUIRE(ring.pop());
+    REQUIRE(produce(ring, "wrapped record")); // skip 16, record 24 at storage begin
+    REQUIRE(ring.get_used_space() == 16 + 24);
+
+    auto record = ring.front();
+    REQUIRE(record.has_value());
+    REQUIRE(as_string_view(*record) == "wrapped record");
+    REQUIRE(reinterpret_cast<std::uintptr_t>(record->data()) % ln::RecordRingView::record_alignment == 0);
+    REQUIRE(ring.pop());
+    REQUIRE(ring.get_used_space() == 0);
+}
+
+TEST_CASE("ln::RecordRing::pop(std::span) copies out whole records", "[ln::RecordRing]") {
+    ln::RecordRing<64> ring{};
+
+    REQUIRE(produce(ring, "message"));
+    std::array<std::byte, 4> small{};
+    REQUIRE_FALSE(ring.pop(small).has_value());
+    REQUIRE(ring.front().has_value()); // kept
+
+    std::array<std::byte, 16> out{};
+    auto size = ring.pop(out);
+    REQUIRE(size == 7);
+    REQUIRE(as_string_view(std::span{out}.first(*size)) == "message");
+    REQUIRE_FALSE(ring.front().has_value());
+}
+
+TEST_CASE("ln::RecordRing multi-producer out-of-order commit", "[ln::RecordRing]") {
+    ln::RecordRing<64> ring{ln::RecordRingView::ProducerMode::multi};
+
+    auto first = ring.reserve(5);
+    auto second = ring.reserve(6);
+    std::ranges::copy(as_bytes("first"), first.begin());
+    std::ranges::copy(as_bytes("second"), second.begin());
+
+    REQUIRE(ring.commit(second));
+    REQUIRE_FALSE(ring.front().has_value()); // held back by the first reservation
+    REQUIRE(ring.commit(first));
+    REQUIRE(as_string_view(*ring.front()) == "first");
+    REQUIRE(ring.pop());
+    REQUIRE(as_string_view(*ring.front()) == "second");
+    REQUIRE(ring.pop());
+}
+
+TEST_CASE("ln::RecordRing concurrent producers and consumer", "[ln::RecordRing][threads]") {
+    static constexpr std::uint32_t producer_count = 3;
+    static constexpr std::uint32_t records_per_producer = 20'000;
+    ln::RecordRing<1024> ring{ln::RecordRingView::ProducerMode::multi};
+
+    struct Message {
+        std::uint32_t producer;
+        std::uint32_t sequence;
+    };
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t p = 0; p < producer_count; ++p) {
+        producers.emplace_back([&ring, p] {
+            for (std::uint32_t seq = 0; seq < records_per_producer;) {
+                // vary record size to exercise skip markers
+                auto record = ring.reserve(sizeof(Message) + (seq % 5) * 4);
+                if (record.empty()) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                const Message message{p, seq};
+                std::memcpy(record.data(), &message, sizeof(message));
+                (void)ring.commit(record);
+                ++seq;
+            }
+        });
+    }
+
+    std::array<std::uint32_t, producer_count> expected{};
+    bool in_order = true;
+    for (std::uint32_t received = 0; received < producer_count * records_per_producer;) {
+        auto record = ring.front();
+        if (!record) {
+            std::this_thread::yield();
+            continue;
+        }
+        Message message{};
+        std::memcpy(&message, record->data(), sizeof(message));
+        in_order = in_order && message.producer < producer_count && message.sequence == expected[message.producer] &&
+                   record->size() == sizeof(Message) + (message.sequence % 5) * 4;
+        ++expected[message.producer % producer_count];
+        (void)ring.pop();
+        ++received;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    REQUIRE(in_order);
+    REQUIRE(ring.get_used_space() == 0);
+}
@@ -0,0 +1,196 @@
+#include "ln/RingBuffer.hpp"
+#include "ln/SpscRingBuffer.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+constexpr std::size_t bench_capacity = 1024;
+constexpr std::uint32_t bench_item_count = 1 << 16;
+
+} // namespace
+
+TEST_CASE("ln::SpscRingBuffer throughput", "[benchmark][ln::SpscRingBuffer]") {
+    BENCHMARK("RingBuffer push/pop (single thread)") {
+        static ln::RingBuffer<std::uint8_t, bench_capacity> rb{};
+        std::uint32_t sum = 0;
+        for (std::uint32_t i = 0; i < bench_item_count; ++i) {
+            (void)rb.push(static_cast<std::uint8_t>(i));
+            sum += *rb.pop();
+        }
+        return sum;
+    };
+
+    BENCHMARK("SpscRingBuffer push/pop (single thread)") {
+        static ln::SpscRingBuffer<std::uint8_t, bench_capacity> rb{};
+        std::uint32_t sum = 0;
+        for (std::uint32_t i = 0; i < bench_item_count; ++i) {
+            (void)rb.push(static_cast<std::uint8_t>(i));
+            sum += *rb.pop();
+        }
+        return sum;
+    };
+
+    BENCHMARK("RingBuffer + mutex producer/consumer threads") {
+        static ln::RingBuffer<std::uint8_t, bench_capacity> rb{};
+        std::mutex mutex;
+        std::thread producer([&] {
+            for (std::uint32_t i = 0; i < bench_item_count;) {
+                std::scoped_lock lock(mutex);
+                if (rb.push(static_cast<std::uint8_t>(i))) {
+                    ++i;
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        std::uint32_t sum = 0;
+        for (std::uint32_t received = 0; received < bench_item_count;) {
+            std::optional<std::uint8_t> v;
+            {
+                std::scoped_lock lock(mutex);
+                v = rb.pop();
+            }
+            if (v) {
+                sum += *v;
+                ++received;
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        return sum;
+    };
+
+    BENCHMARK("SpscRingBuffer producer/consumer threads") {
+        static ln::SpscRingBuffer<std::uint8_t, bench_capacity> rb{};
+        std::thread producer([&] {
+            for (std::uint32_t i = 0; i < bench_item_count;) {
+                if (rb.push(static_cast<std::uint8_t>(i))) {
+                    ++i;
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        std::uint32_t sum = 0;
+        for (std::uint32_t received = 0; received < bench_item_count;) {
+            if (auto v = rb.pop()) {
+                sum += *v;
+                ++received;
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        return sum;
+    };
+}
+
+TEST_CASE("ln::RingBuffer modulo vs mask indexing", "[benchmark][ln::RingBuffer][pow2]") {
+    static std::array<std::uint8_t, bench_capacity> mod_storage{};
+    static std::array<std::uint8_t, bench_capacity> pow2_storage{};
+    ln::RingBufferView<std::uint8_t> mod(mod_storage);
+    ln::PowerOfTwoRingBufferView<std::uint8_t> pow2(pow2_storage);
+    for (std::size_t i = 0; i < bench_capacity / 2; ++i) {
+        (void)mod.push(0);
+        (void)pow2.push(0);
+    }
+
+    BENCHMARK("modulo push/pop") {
+        std::uint32_t sum = 0;
+        for (std::uint32_t i = 0; i < bench_item_count; ++i) {
+            (void)mod.push(static_cast<std::uint8_t>(i));
+            sum += *mod.pop();
+        }
+        return sum;
+    };
+
+    BENCHMARK("mask push/pop") {
+        std::uint32_t sum = 0;
+        for (std::uint32_t i = 0; i < bench_item_count; ++i) {
+            (void)pow2.push(static_cast<std::uint8_t>(i));
+            sum += *pow2.pop();
+        }
+        return sum;
+    };
+
+    BENCHMARK("modulo iterate") {
+        std::uint32_t sum = 0;
+        for (const auto v : mod) {
+            sum += v;
+        }
+        return sum;
+    };
+
+    BENCHMARK("mask iterate") {
+        std::uint32_t sum = 0;
+        for (const auto v : pow2) {
+            sum += v;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("ln::RingBuffer bulk vs per-element drain", "[benchmark][ln::RingBuffer][span]") {
+    static constexpr std::size_t uart_buffer_size = 4096;
+    static ln::RingBuffer<std::uint8_t, uart_buffer_size> rb{};
+    static std::array<std::uint8_t, uart_buffer_size> chunk{};
+    static std::array<std::uint8_t, uart_buffer_size> out{};
+
+    // Start half way through storage so every drain crosses the wrap point.
+    const auto refill = [] {
+        rb.clear();
+        (void)rb.push(std::span<const std::uint8_t>{chunk}.first(uart_buffer_size / 2));
+        (void)rb.discard(uart_buffer_size / 2);
+        (void)rb.push(chunk);
+    };
+
+    // Both variants pay the same refill cost, the difference is the drain.
+    BENCHMARK("refill + pop() per element") {
+        refill();
+        std::size_t n = 0;
+        while (auto v = rb.pop()) {
+            out[n++] = *v;
+        }
+        return n;
+    };
+
+    BENCHMARK("refill + pop(std::span)") {
+        refill();
+        return rb.pop(out);
+    };
+}
+
+TEST_CASE("ln::RingBuffer delimiter search", "[benchmark][ln::RingBuffer][find]") {
+    static constexpr std::size_t history_size = 4096;
+    static std::array<char, history_size> storage{};
+    static ln::PowerOfTwoRingBufferView<char> rb(storage); // as the shell history
+    rb.clear();
+    static std::array<char, history_size> line{};
+    line.fill('a');
+    (void)rb.push(std::span<const char>{line}.first(history_size / 2));
+    (void)rb.discard(history_size / 2);
+    line.back() = '\n';
+    (void)rb.push(std::span<const char>{line}); // delimiter at the very end, data wraps
+
+    BENCHMARK("std::ranges::find via iterators") { return std::ranges::find(rb, '\n') - rb.begin(); };
+
+    BENCHMARK("RingBufferView::find") { return rb.find('\n'); };
+
+    BENCHMARK("std::ranges::find reverse via iterators") {
+        auto reversed = rb | std::views::reverse;
+        return std::ranges::find(reversed | std::views::drop(1), 'x') - reversed.begin();
+    };
+
+    BENCHMARK("RingBufferView::rfind") { return rb.rfind('x'); };
+}
@@ -1,7 +1,13 @@
 #include "ln/RingBuffer.hpp"
 
 #include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
 #include <ranges>
+#include <string_view>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
 
 TEST_CASE("ln::RingBufferView basic push/pop", "[ln::RingBufferView]") {
     std::array<int, 4> storage{};
@@ -397,3 +403,470 @@ TEST_CASE("ln::RingBuffer range reverse iteration", "[ln::RingBuffer][ranges]")
         ++idx;
     }
 }
+
+TEST_CASE("ln::RingBuffer of any capacity is a RingBufferView", "[ln::RingBuffer][pow2]") {
+    STATIC_REQUIRE(std::is_base_of_v<ln::RingBufferView<int>, ln::RingBuffer<int, 8>>);
+    STATIC_REQUIRE(std::is_base_of_v<ln::RingBufferView<int>, ln::RingBuffer<int, 6>>);
+    STATIC_REQUIRE(sizeof(ln::PowerOfTwoRingBufferView<int>) < sizeof(ln::RingBufferView<int>));
+
+    auto fill = [](ln::RingBufferView<int> &view) {
+        for (int i = 0; i < 10; ++i) {
+            (void)view.push_overwrite(i);
+        }
+    };
+    ln::RingBuffer<int, 8> rb{};
+    fill(rb);
+    REQUIRE(rb.size() == 8);
+    REQUIRE(rb[0] == 2);
+    REQUIRE(rb[7] == 9);
+}
+
+TEST_CASE("ln::PowerOfTwoRingBufferView over span", "[ln::RingBufferView][pow2]") {
+    std::array<int, 8> storage{};
+    ln::PowerOfTwoRingBufferView<int> rb(std::span<int>{storage});
+
+    REQUIRE(rb.capacity() == 8);
+    REQUIRE(rb.empty());
+
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(rb.push(i));
+    }
+    REQUIRE(rb.full());
+    REQUIRE_FALSE(rb.push(8));
+    REQUIRE(rb.push_overwrite(8));
+    REQUIRE(rb.size() == 8);
+    REQUIRE(rb[0] == 1);
+    REQUIRE(rb[7] == 8);
+}
+
+TEST_CASE("ln::PowerOfTwoRingBufferView over an empty span", "[ln::RingBufferView][pow2]") {
+    ln::PowerOfTwoRingBufferView<int> rb(std::span<int>{});
+
+    REQUIRE(rb.capacity() == 0);
+    REQUIRE(rb.empty());
+    REQUIRE_FALSE(rb.push(1));
+}
+
+TEST_CASE("ln::RingBuffer power of two and modulo indexing behave the same", "[ln::RingBuffer][pow2]") {
+    std::array<int, 4> pow2_storage{};
+    std::array<int, 4> mod_storage{};
+    ln::PowerOfTwoRingBufferView<int> pow2(pow2_storage);
+    ln::RingBufferView<int> mod(mod_storage);
+
+    std::srand(1234);
+    int next = 0;
+    for (int step = 0; step < 1000; ++step) {
+        switch (std::rand() % 5) {
+        case 0:
+            REQUIRE(pow2.push(next) == mod.push(next));
+            break;
+        case 1:
+            REQUIRE(pow2.push_overwrite(next) == mod.push_overwrite(next));
+            break;
+        case 2: {
+            std::array<int, 3> values{{next, next + 1, next + 2}};
+            REQUIRE(pow2.push(values) == mod.push(values));
+            break;
+        }
+        default:
+            REQUIRE(pow2.pop() == mod.pop());
+            break;
+        }
+        ++next;
+        REQUIRE(pow2.size() == mod.size());
+        REQUIRE(std::ranges::equal(pow2, mod));
+    }
+}
+
+TEST_CASE("ln::RingBuffer::pop(std::span) drains across wrap-around", "[ln::RingBuffer][span]") {
+    ln::RingBuffer<int, 5> rb{};
+
+    std::array<int, 4> a{{1, 2, 3, 4}};
+    REQUIRE(rb.push(a));
+    REQUIRE(rb.discard(3) == 3);
+    std::array<int, 4> b{{5, 6, 7, 8}};
+    REQUIRE(rb.push(b)); // stored data now wraps: 4 | 5 6 7 8
+
+    std::array<int, 3> out{};
+    REQUIRE(rb.pop(out) == 3);
+    REQUIRE(out == std::array<int, 3>{{4, 5, 6}});
+    REQUIRE(rb.size() == 2);
+
+    std::array<int, 8> rest{};
+    REQUIRE(rb.pop(rest) == 2);
+    REQUIRE(rest[0] == 7);
+    REQUIRE(rest[1] == 8);
+    REQUIRE(rb.empty());
+    REQUIRE(rb.pop(rest) == 0);
+}
+
+TEST_CASE("ln::RingBuffer::peek(std::span) copies without removing", "[ln::RingBuffer][span]") {
+    ln::RingBuffer<int, 4> rb{};
+
+    std::array<int, 3> a{{1, 2, 3}};
+    REQUIRE(rb.push(a));
+    REQUIRE(rb.discard(2) == 2);
+    std::array<int, 3> b{{4, 5, 6}};
+    REQUIRE(rb.push(b)); // 3 4 | 5 6
+
+    std::array<int, 4> out{};
+    REQUIRE(rb.peek(out) == 4);
+    REQUIRE(out == std::array<int, 4>{{3, 4, 5, 6}});
+    REQUIRE(rb.size() == 4);
+
+    std::array<int, 2> window{};
+    REQUIRE(rb.peek(window, 1) == 2);
+    REQUIRE(window == std::array<int, 2>{{4, 5}});
+    REQUIRE(rb.peek(window, 3) == 1);
+    REQUIRE(window[0] == 6);
+    REQUIRE(rb.peek(window, 4) == 0);
+}
+
+TEST_CASE("ln::RingBuffer::discard drops at most size() elements", "[ln::RingBuffer]") {
+    ln::RingBuffer<int, 3> rb{};
+
+    REQUIRE(rb.push(1));
+    REQUIRE(rb.push(2));
+    REQUIRE(rb.discard(1) == 1);
+    REQUIRE(rb[0] == 2);
+    REQUIRE(rb.discard(10) == 1);
+    REQUIRE(rb.empty());
+    REQUIRE(rb.discard(1) == 0);
+}
+
+TEST_CASE("ln::RingBuffer::writable_span/commit appends in place", "[ln::RingBuffer][zero-copy]") {
+    ln::RingBuffer<int, 5> rb{};
+
+    auto region = rb.writable_span();
+    REQUIRE(region.size() == 5);
+    region[0] = 1;
+    region[1] = 2;
+    region[2] = 3;
+    REQUIRE(rb.commit(3));
+    REQUIRE(rb.size() == 3);
+
+    REQUIRE(rb.discard(2) == 2);
+    region = rb.writable_span(); // contiguous up to end of storage only
+    REQUIRE(region.size() == 2);
+    REQUIRE_FALSE(rb.commit(3));
+    region[0] = 4;
+    region[1] = 5;
+    REQUIRE(rb.commit(2));
+
+    region = rb.writable_span(); // wrapped to storage begin, up to head
+    REQUIRE(region.size() == 2);
+    region[0] = 6;
+    REQUIRE(rb.commit(1));
+
+    std::array<int, 4> expected{{3, 4, 5, 6}};
+    REQUIRE(std::ranges::equal(rb, expected));
+
+    REQUIRE(rb.commit(1));
+    REQUIRE(rb.full());
+    REQUIRE(rb.writable_span().empty());
+    REQUIRE_FALSE(rb.commit(1));
+}
+
+TEST_CASE("ln::RingBuffer::readable_spans/consume reads in place", "[ln::RingBuffer][zero-copy]") {
+    ln::RingBuffer<int, 4> rb{};
+
+    auto [first, second] = rb.readable_spans();
+    REQUIRE(first.empty());
+    REQUIRE(second.empty());
+
+    std::array<int, 3> a{{1, 2, 3}};
+    REQUIRE(rb.push(a));
+    REQUIRE(rb.consume(2));
+    std::array<int, 3> b{{4, 5, 6}};
+    REQUIRE(rb.push(b)); // 3 4 | 5 6
+
+    auto spans = rb.readable_spans();
+    REQUIRE(spans[0].size() == 2);
+    REQUIRE(spans[1].size() == 2);
+    REQUIRE(spans[0][0] == 3);
+    REQUIRE(spans[0][1] == 4);
+    REQUIRE(spans[1][0] == 5);
+    REQUIRE(spans[1][1] == 6);
+
+    const auto &crb = rb;
+    REQUIRE(crb.readable_spans()[1].size() == 2);
+
+    REQUIRE_FALSE(rb.consume(5));
+    REQUIRE(rb.consume(3));
+    spans = rb.readable_spans();
+    REQUIRE(spans[0].size() == 1);
+    REQUIRE(spans[0][0] == 6);
+    REQUIRE(spans[1].empty());
+}
+
+TEST_CASE("ln::RingBuffer::chunks splits a logical range at the wrap point", "[ln::RingBuffer][chunks]") {
+    ln::RingBuffer<int, 5> rb{};
+
+    std::array<int, 4> a{{0, 0, 0, 1}};
+    REQUIRE(rb.push(a));
+    REQUIRE(rb.discard(3) == 3);
+    std::array<int, 3> b{{2, 3, 4}};
+    REQUIRE(rb.push(b)); // 1 | 2 3 4
+
+    auto [first, second] = rb.chunks();
+    REQUIRE(first.size() == 2);
+    REQUIRE(first[0] == 1);
+    REQUIRE(first[1] == 2);
+    REQUIRE(second.size() == 2);
+    REQUIRE(second[0] == 3);
+    REQUIRE(second[1] == 4);
+
+    auto tail_chunks = rb.chunks(2);
+    REQUIRE(tail_chunks[0].size() == 2);
+    REQUIRE(tail_chunks[0][0] == 3);
+    REQUIRE(tail_chunks[1].empty());
+
+    auto middle = rb.chunks(1, 2);
+    REQUIRE(middle[0].size() == 1);
+    REQUIRE(middle[0][0] == 2);
+    REQUIRE(middle[1].size() == 1);
+    REQUIRE(middle[1][0] == 3);
+
+    auto clamped = rb.chunks(3, 100);
+    REQUIRE(clamped[0].size() + clamped[1].size() == 1);
+    REQUIRE(rb.chunks(10)[0].empty());
+}
+
+TEST_CASE("ln::RingBuffer::find/rfind search across the wrap point", "[ln::RingBuffer][find]") {
+    ln::RingBuffer<char, 8> rb{};
+
+    std::string_view filler = "xxxxx";
+    REQUIRE(rb.push(std::span<const char>{filler}));
+    REQUIRE(rb.discard(filler.size()) == filler.size());
+    std::string_view lines = "ab\ncd\nef"; // wraps after "ab\n"
+    REQUIRE(rb.push(std::span<const char>{lines}));
+
+    REQUIRE(rb.find('\n') == 2);
+    REQUIRE(rb.find('\n', 3) == 5);
+    REQUIRE(rb.find('\n', 6) == rb.size());
+    REQUIRE(rb.find('\n', 0, 2) == 2); // not found within [0, 2)
+    REQUIRE(rb.find('z') == rb.size());
+
+    REQUIRE(rb.rfind('\n') == 5);
+    REQUIRE(rb.rfind('\n', 0, 5) == 2);
+    REQUIRE(rb.rfind('\n', 3, 5) == 5); // not found within [3, 5)
+    REQUIRE(rb.rfind('a') == 0);
+    REQUIRE(rb.rfind('f') == 7);
+}
+
+TEST_CASE("ln::RingBuffer::find/rfind on non-byte elements", "[ln::RingBuffer][find]") {
+    ln::RingBuffer<int, 5> rb{};
+
+    std::array<int, 3> a{{7, 7, 1}};
+    REQUIRE(rb.push(a));
+    REQUIRE(rb.discard(2) == 2);
+    std::array<int, 4> b{{2, 1, 3, 1}};
+    REQUIRE(rb.push(b)); // 1 2 1 | 3 1
+
+    REQUIRE(rb.find(1) == 0);
+    REQUIRE(rb.find(1, 1) == 2);
+    REQUIRE(rb.find(3) == 3);
+    REQUIRE(rb.rfind(1) == 4);
+    REQUIRE(rb.rfind(1, 0, 4) == 2);
+    REQUIRE(rb.rfind(9) == rb.size());
+}
+
+TEST_CASE("ln::StaticRingBuffer picks the smallest index type", "[ln::StaticRingBuffer]") {
+    STATIC_REQUIRE(std::is_same_v<ln::StaticRingBuffer<char, 100>::index_type, std::uint8_t>);
+    STATIC_REQUIRE(std::is_same_v<ln::StaticRingBuffer<char, 255>::index_type, std::uint8_t>);
+    STATIC_REQUIRE(std::is_same_v<ln::StaticRingBuffer<char, 256>::index_type, std::uint16_t>);
+    STATIC_REQUIRE(std::is_same_v<ln::StaticRingBuffer<char, 65536>::index_type, std::size_t>);
+
+    STATIC_REQUIRE(sizeof(ln::StaticRingBuffer<char, 64>) == 64 + 2);  // head, tail
+    STATIC_REQUIRE(sizeof(ln::StaticRingBuffer<char, 100>) == 100 + 3); // head, tail, count
+    STATIC_REQUIRE(sizeof(ln::StaticRingBuffer<char, 64>) < sizeof(ln::RingBuffer<char, 64>));
+}
+
+template <typename Static, typename Reference> void require_same_behaviour(Static &rb, Reference &reference) {
+    std::srand(4321);
+    int next = 0;
+    for (int step = 0; step < 5000; ++step) {
+        switch (std::rand() % 6) {
+        case 0:
+            REQUIRE(rb.push(next) == reference.push(next));
+            break;
+        case 1:
+            REQUIRE(rb.push_overwrite(next) == reference.push_overwrite(next));
+            break;
+        case 2: {
+            std::array<int, 7> values{{next, next + 1, next + 2, next + 3, next + 4, next + 5, next + 6}};
+            REQUIRE(rb.push(values) == reference.push(values));
+            break;
+        }
+        case 3: {
+            std::array<int, 5> out{};
+            std::array<int, 5> reference_out{};
+            REQUIRE(rb.pop(out) == reference.pop(reference_out));
+            REQUIRE(out == reference_out);
+            break;
+        }
+        default:
+            REQUIRE(rb.pop() == reference.pop());
+            break;
+        }
+        ++next;
+        REQUIRE(rb.size() == reference.size());
+        REQUIRE(std::ranges::equal(rb, reference));
+    }
+}
+
+TEST_CASE("ln::StaticRingBuffer behaves like ln::RingBuffer", "[ln::StaticRingBuffer]") {
+    SECTION("power of two, free-running uint8_t indices wrap") {
+        ln::StaticRingBuffer<int, 16> rb{};
+        ln::RingBuffer<int, 16> reference{};
+        require_same_behaviour(rb, reference);
+    }
+    SECTION("power of two at the uint8_t limit") {
+        ln::StaticRingBuffer<int, 128> rb{};
+        ln::RingBuffer<int, 128> reference{};
+        require_same_behaviour(rb, reference);
+    }
+    SECTION("modulo") {
+        ln::StaticRingBuffer<int, 10> rb{};
+        ln::RingBuffer<int, 10> reference{};
+        require_same_behaviour(rb, reference);
+    }
+}
+
+TEST_CASE("ln::StaticRingBuffer zero-copy and search API", "[ln::StaticRingBuffer]") {
+    ln::StaticRingBuffer<char, 8> rb{};
+    REQUIRE(rb.push(std::span<const char>{std::string_view{"abcdef"}}));
+    REQUIRE(rb.discard(5) == 5);
+
+    auto writable = rb.writable_span();
+    REQUIRE(writable.size() == 2);
+    writable[0] = '\n';
+    writable[1] = 'x';
+    REQUIRE(rb.commit(2));
+    REQUIRE(rb.push(std::span<const char>{std::string_view{"y\n"}})); // f \n x | y \n
+
+    REQUIRE(rb.find('\n') == 1);
+    REQUIRE(rb.rfind('\n') == 4);
+    const auto [first, second] = rb.chunks();
+    REQUIRE(first.size() == 3);
+    REQUIRE(second.size() == 2);
+}
+
+namespace {
+
+struct Tracked {
+    static inline int live = 0;
+    static inline int copies = 0;
+
+    explicit Tracked(int value) : value(value) { ++live; }
+    Tracked(const Tracked &other) : value(other.value) {
+        ++live;
+        ++copies;
+    }
+    Tracked(Tracked &&other) noexcept : value(other.value) { ++live; }
+    Tracked &operator=(const Tracked &other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+    Tracked &operator=(Tracked &&other) noexcept {
+        value = other.value;
+        return *this;
+    }
+    ~Tracked() { --live; }
+
+    int value;
+};
+
+} // namespace
+
+TEST_CASE("ln::RingBuffer emplace, push(T&&) and pop_into", "[ln::RingBuffer][move]") {
+    struct Message {
+        int id;
+        std::array<char, 32> payload;
+    };
+    ln::RingBuffer<Message, 4> rb{};
+
+    REQUIRE(rb.emplace(1, std::array<char, 32>{'a'}));
+    REQUIRE(rb.push(Message{2, {'b'}}));
+    REQUIRE(rb.emplace_overwrite(3, std::array<char, 32>{'c'}));
+
+    Message out{};
+    REQUIRE(rb.pop_into(out));
+    REQUIRE(out.id == 1);
+    REQUIRE(out.payload[0] == 'a');
+    REQUIRE(rb.pop_into(out));
+    REQUIRE(out.id == 2);
+    REQUIRE(rb.size() == 1);
+    rb.clear();
+    REQUIRE_FALSE(rb.pop_into(out));
+    REQUIRE(out.id == 2);
+}
+
+TEST_CASE("ln::StaticRingBuffer non-trivial elements are destroyed on removal", "[ln::StaticRingBuffer][move]") {
+    Tracked::live = 0;
+    Tracked::copies = 0;
+    {
+        ln::StaticRingBuffer<Tracked, 3, ln::RingBufferElements::non_trivial> rb{};
+        STATIC_REQUIRE(decltype(rb)::manages_lifetime);
+
+        REQUIRE(rb.emplace(1));
+        REQUIRE(rb.push(Tracked{2}));
+        REQUIRE(rb.emplace(3));
+        REQUIRE(Tracked::live == 3);
+        REQUIRE_FALSE(rb.emplace(4));
+        REQUIRE(Tracked::live == 3);
+
+        REQUIRE(rb.emplace_overwrite(4)); // destroys 1
+        REQUIRE(Tracked::live == 3);
+        REQUIRE(rb[0].value == 2);
+
+        Tracked out{0};
+        REQUIRE(rb.pop_into(out));
+        REQUIRE(out.value == 2);
+        REQUIRE(Tracked::live == 3); // 2 slots + out
+
+        auto popped = rb.pop();
+        REQUIRE(popped.has_value());
+        REQUIRE(popped->value == 3);
+        popped.reset();
+        REQUIRE(Tracked::live == 2);
+
+        REQUIRE(rb.discard(5) == 1);
+        REQUIRE(Tracked::live == 1);
+
+        const std::array<Tracked, 2> values{Tracked{5}, Tracked{6}};
+        REQUIRE(rb.push(values));
+        REQUIRE(Tracked::live == 5);
+        rb.clear();
+        REQUIRE(Tracked::live == 3);
+        REQUIRE(rb.push(values));
+        REQUIRE(Tracked::live == 5);
+    }
+    REQUIRE(Tracked::live == 0);
+    REQUIRE(Tracked::copies == 4); // only push(std::span) copies
+}
+
+TEST_CASE("ln::StaticRingBuffer non-trivial move-only elements", "[ln::StaticRingBuffer][move]") {
+    ln::StaticRingBuffer<std::unique_ptr<int>, 2, ln::RingBufferElements::non_trivial> rb{};
+
+    REQUIRE(rb.push(std::make_unique<int>(1)));
+    REQUIRE(rb.emplace(new int{2}));
+    REQUIRE(rb.push_overwrite(std::make_unique<int>(3)));
+
+    std::array<std::unique_ptr<int>, 2> out{};
+    REQUIRE(rb.pop(out) == 2);
+    REQUIRE(*out[0] == 2);
+    REQUIRE(*out[1] == 3);
+    REQUIRE(rb.empty());
+}
+
+TEST_CASE("ln::RingBuffer::push(std::span) in overwrite mode longer than capacity", "[ln::RingBuffer][span]") {
+    ln::RingBuffer<int, 3> rb{};
+    REQUIRE(rb.push(1));
+
+    const std::array<int, 5> values{{2, 3, 4, 5, 6}};
+    REQUIRE(rb.push_overwrite(values));
+    REQUIRE(rb.size() == 3);
+    REQUIRE(std::ranges::equal(rb, std::array<int, 3>{{4, 5, 6}}));
+}
@@ -0,0 +1,89 @@
+#include "ln/SeqLock.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Config {
+    std::uint32_t version;
+    std::array<std::uint16_t, 23> gains; // odd size, not a whole number of words
+};
+
+} // namespace
+
+TEST_CASE("ln::SeqLock stores and loads a value", "[ln::SeqLock]") {
+    ln::SeqLock<Config> lock{Config{7, {1, 2, 3}}};
+    REQUIRE(lock.get_version() == 0);
+    Config config = lock.load();
+    REQUIRE(config.version == 7);
+    REQUIRE(config.gains[2] == 3);
+    REQUIRE(config.gains[22] == 0);
+
+    config.version = 8;
+    config.gains[22] = 0xBEEF;
+    lock.store(config);
+    REQUIRE(lock.get_version() == 1);
+
+    Config loaded{};
+    REQUIRE(lock.try_load(loaded));
+    REQUIRE(loaded.version == 8);
+    REQUIRE(loaded.gains[22] == 0xBEEF);
+    REQUIRE(loaded.gains[0] == 1);
+
+    ln::SeqLock<double> scalar{};
+    REQUIRE(scalar.load() == 0.0);
+    scalar.store(0.5);
+    REQUIRE(scalar.load() == 0.5);
+}
+
+TEST_CASE("ln::SeqLock readers never see a torn value", "[ln::SeqLock][threads]") {
+    static constexpr std::uint32_t store_count = 200'000;
+    static constexpr int reader_count = 3;
+    ln::SeqLock<Config> lock{};
+    std::atomic<bool> done{false};
+    std::atomic<std::uint32_t> torn{0};
+    std::atomic<std::uint32_t> backwards{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < reader_count; ++r) {
+        readers.emplace_back([&] {
+            std::uint32_t last = 0;
+            while (!done) {
+                Config config{};
+                if (!lock.try_load(config)) {
+                    config = lock.load();
+                }
+                for (const std::uint16_t gain : config.gains) {
+                    if (gain != static_cast<std::uint16_t>(config.version)) {
+                        torn.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                if (config.version < last) {
+                    backwards.fetch_add(1, std::memory_order_relaxed);
+                }
+                last = config.version;
+            }
+        });
+    }
+
+    for (std::uint32_t i = 1; i <= store_count; ++i) {
+        Config config{i, {}};
+        config.gains.fill(static_cast<std::uint16_t>(i));
+        lock.store(config);
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(torn == 0);
+    REQUIRE(backwards == 0);
+    REQUIRE(lock.load().version == store_count);
+    REQUIRE(lock.get_version() == store_count);
+}
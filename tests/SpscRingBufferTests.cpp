@@ -0,0 +1,234 @@
+#include "ln/SpscRingBuffer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <thread>
+
+TEST_CASE("ln::SpscRingBufferView basic push/pop", "[ln::SpscRingBufferView]") {
+    std::array<int, 4> storage{};
+    ln::SpscRingBufferView<int> rb(storage);
+
+    REQUIRE(rb.empty());
+    REQUIRE(rb.size() == 0);
+    REQUIRE(rb.capacity() == 4);
+
+    REQUIRE(rb.push(1));
+    REQUIRE_FALSE(rb.empty());
+    REQUIRE(rb.size() == 1);
+
+    auto v = rb.pop();
+    REQUIRE(v.has_value());
+    REQUIRE(v.value() == 1);
+    REQUIRE(rb.empty());
+    REQUIRE_FALSE(rb.pop().has_value());
+}
+
+TEST_CASE("ln::SpscRingBuffer fill and full", "[ln::SpscRingBuffer]") {
+    ln::SpscRingBuffer<int, 3> rb{};
+
+    REQUIRE(rb.get_free_space() == 3);
+
+    REQUIRE(rb.push(10));
+    REQUIRE(rb.push(20));
+    REQUIRE(rb.push(30));
+
+    REQUIRE(rb.full());
+    REQUIRE(rb.size() == 3);
+    REQUIRE(rb.get_free_space() == 0);
+    REQUIRE_FALSE(rb.push(40));
+
+    REQUIRE(rb.pop() == 10);
+    REQUIRE(rb.pop() == 20);
+    REQUIRE(rb.pop() == 30);
+    REQUIRE(rb.empty());
+}
+
+TEST_CASE("ln::SpscRingBuffer preserves FIFO order across many wrap-arounds", "[ln::SpscRingBuffer]") {
+    ln::SpscRingBuffer<int, 3> rb{};
+
+    int next_in = 0;
+    int next_out = 0;
+    for (int round = 0; round < 20; ++round) {
+        while (rb.push(next_in)) {
+            ++next_in;
+        }
+        REQUIRE(rb.full());
+        for (int i = 0; i < 2; ++i) {
+            auto v = rb.pop();
+            REQUIRE(v.has_value());
+            REQUIRE(v.value() == next_out);
+            ++next_out;
+        }
+        REQUIRE(rb.size() == 1);
+    }
+}
+
+TEST_CASE("ln::SpscRingBuffer::push(std::span) fails without enough space", "[ln::SpscRingBuffer][span]") {
+    ln::SpscRingBuffer<int, 4> rb{};
+
+    std::array<int, 2> initial{{1, 2}};
+    REQUIRE(rb.push(initial));
+
+    std::array<int, 3> too_many{{3, 4, 5}};
+    REQUIRE_FALSE(rb.push(too_many));
+    CHECK(rb.size() == 2);
+    REQUIRE(rb.pop() == 1);
+    REQUIRE(rb.pop() == 2);
+}
+
+TEST_CASE("ln::SpscRingBuffer::push(std::span) handles wrap-around correctly", "[ln::SpscRingBuffer][span]") {
+    ln::SpscRingBuffer<int, 5> rb{};
+
+    std::array<int, 3> a{{1, 2, 3}};
+    REQUIRE(rb.push(a));
+    REQUIRE(rb.pop() == 1);
+    REQUIRE(rb.pop() == 2);
+
+    std::array<int, 4> b{{4, 5, 6, 7}};
+    REQUIRE(rb.push(b));
+    CHECK(rb.full());
+    for (int expected = 3; expected <= 7; ++expected) {
+        REQUIRE(rb.pop() == expected);
+    }
+    REQUIRE(rb.empty());
+}
+
+TEST_CASE("ln::SpscRingBuffer::clear drops stored elements", "[ln::SpscRingBuffer]") {
+    ln::SpscRingBuffer<int, 4> rb{};
+
+    REQUIRE(rb.push(1));
+    REQUIRE(rb.push(2));
+    rb.clear();
+
+    REQUIRE(rb.empty());
+    REQUIRE(rb.get_free_space() == rb.capacity());
+    REQUIRE(rb.push(3));
+    REQUIRE(rb.pop() == 3);
+}
+
+TEST_CASE("ln::SpscRingBuffer zero-copy commit and consume", "[ln::SpscRingBuffer][zero-copy]") {
+    ln::SpscRingBuffer<int, 4> rb{};
+
+    auto region = rb.writable_span();
+    REQUIRE(region.size() == 4);
+    region[0] = 1;
+    region[1] = 2;
+    region[2] = 3;
+    REQUIRE(rb.commit(3));
+    REQUIRE(rb.consume(2));
+
+    region = rb.writable_span();
+    REQUIRE(region.size() == 1);
+    REQUIRE_FALSE(rb.commit(2));
+    region[0] = 4;
+    REQUIRE(rb.commit(1));
+    region = rb.writable_span();
+    REQUIRE(region.size() == 2);
+    region[0] = 5;
+    REQUIRE(rb.commit(1)); // 3 4 | 5
+
+    auto spans = rb.readable_spans();
+    REQUIRE(spans[0].size() == 2);
+    REQUIRE(spans[0][0] == 3);
+    REQUIRE(spans[0][1] == 4);
+    REQUIRE(spans[1].size() == 1);
+    REQUIRE(spans[1][0] == 5);
+    REQUIRE_FALSE(rb.consume(4));
+    REQUIRE(rb.consume(3));
+    REQUIRE(rb.empty());
+}
+
+TEST_CASE("ln::SpscRingBuffer keeps head and tail on separate cache lines", "[ln::SpscRingBuffer]") {
+    STATIC_REQUIRE(alignof(ln::SpscRingBufferView<char>) >= ln::cache_line_size);
+    STATIC_REQUIRE(sizeof(ln::SpscRingBufferView<char>) >= 2 * ln::cache_line_size);
+}
+
+TEST_CASE("ln::SpscRingBuffer concurrent producer/consumer stress", "[ln::SpscRingBuffer][threads]") {
+    static constexpr std::uint32_t item_count = 1'000'000;
+    ln::SpscRingBuffer<std::uint32_t, 61> rb{}; // odd capacity to exercise non power-of-two wrap
+
+    std::thread producer([&rb] {
+        std::array<std::uint32_t, 7> chunk{};
+        std::uint32_t next = 0;
+        while (next < item_count) {
+            if (next % 3 == 0 && item_count - next >= chunk.size()) {
+                for (std::uint32_t i = 0; i < chunk.size(); ++i) {
+                    chunk[i] = next + i;
+                }
+                if (rb.push(chunk)) {
+                    next += chunk.size();
+                }
+                else {
+                    std::this_thread::yield();
+                }
+                continue;
+            }
+            if (rb.push(next)) {
+                ++next;
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::uint32_t expected = 0;
+    bool in_order = true;
+    while (expected < item_count) {
+        auto v = rb.pop();
+        if (!v) {
+            std::this_thread::yield();
+            continue;
+        }
+        in_order = in_order && (*v == expected);
+        ++expected;
+    }
+    producer.join();
+
+    REQUIRE(in_order);
+    REQUIRE(rb.empty());
+}
+
+TEST_CASE("ln::SpscRingBuffer concurrent zero-copy producer/consumer", "[ln::SpscRingBuffer][zero-copy][threads]") {
+    static constexpr std::uint32_t item_count = 200'000;
+    ln::SpscRingBuffer<std::uint32_t, 64> rb{};
+
+    std::thread producer([&rb] {
+        std::uint32_t next = 0;
+        while (next < item_count) {
+            auto region = rb.writable_span();
+            const auto n = std::min<std::size_t>(region.size(), item_count - next);
+            if (n == 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                region[i] = next++;
+            }
+            (void)rb.commit(n);
+        }
+    });
+
+    std::uint32_t expected = 0;
+    bool in_order = true;
+    while (expected < item_count) {
+        std::size_t n = 0;
+        for (auto span : rb.readable_spans()) {
+            for (auto v : span) {
+                in_order = in_order && (v == expected);
+                ++expected;
+            }
+            n += span.size();
+        }
+        if (n == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        (void)rb.consume(n);
+    }
+    producer.join();
+
+    REQUIRE(in_order);
+    REQUIRE(rb.empty());
+}
@@ -0,0 +1,127 @@
+#include "ln/StaticHashMap.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+// every key collides, so everything is one probe sequence
+struct CollidingHash {
+    constexpr size_t operator()(int /*key*/) const noexcept { return 3; }
+};
+
+constexpr auto make_constant_map() {
+    ln::StaticHashMap<std::string_view, int, 8> map{};
+    (void)map.insert("one", 1);
+    (void)map.insert("two", 2);
+    (void)map.insert("three", 3);
+    return map;
+}
+
+constinit ln::StaticHashMap<int, int, 4> constant_initialized{};
+
+} // namespace
+
+TEST_CASE("ln::StaticHashMap inserts, finds and erases", "[ln::StaticHashMap]") {
+    ln::StaticHashMap<int, int, 8> map{};
+    REQUIRE(map.empty());
+    REQUIRE(map.capacity() == 8);
+    REQUIRE(map.find(1) == nullptr);
+
+    REQUIRE(map.insert(1, 10));
+    REQUIRE(map.insert(2, 20));
+    REQUIRE_FALSE(map.insert(1, 11));
+    REQUIRE(*map.find(1) == 10);
+    REQUIRE(map.insert_or_assign(1, 12));
+    REQUIRE(*map.find(1) == 12);
+    REQUIRE(map.size() == 2);
+
+    *map.find(2) = 21;
+    REQUIRE(*map.find(2) == 21);
+    REQUIRE(map.erase(2));
+    REQUIRE_FALSE(map.erase(2));
+    REQUIRE_FALSE(map.contains(2));
+    REQUIRE(map.contains(1));
+
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE_FALSE(map.contains(1));
+}
+
+TEST_CASE("ln::StaticHashMap fills up completely", "[ln::StaticHashMap]") {
+    ln::StaticHashMap<int, int, 5, CollidingHash> map{};
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(map.insert(i, i * 10));
+    }
+    REQUIRE(map.full());
+    REQUIRE_FALSE(map.insert(5, 50));
+    REQUIRE_FALSE(map.insert_or_assign(5, 50));
+    REQUIRE(map.insert_or_assign(4, 41));
+    REQUIRE(map.get_max_probe_length() == 5);
+    // a miss on a full table still terminates
+    REQUIRE_FALSE(map.contains(5));
+
+    // erasing from the middle of the sequence shifts the rest back
+    REQUIRE(map.erase(1));
+    REQUIRE(map.get_max_probe_length() == 4);
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(map.contains(i) == (i != 1));
+    }
+    REQUIRE(*map.find(4) == 41);
+    REQUIRE(map.insert(5, 50));
+    REQUIRE(*map.find(5) == 50);
+
+    int sum = 0;
+    map.for_each([&](int key, int /*value*/) { sum += key; });
+    REQUIRE(sum == 0 + 2 + 3 + 4 + 5);
+}
+
+TEST_CASE("ln::StaticHashMap looks string keys up without converting", "[ln::StaticHashMap]") {
+    static constexpr auto map = make_constant_map();
+    STATIC_REQUIRE(map.size() == 3);
+    STATIC_REQUIRE(*map.find(std::string_view{"two"}) == 2);
+    STATIC_REQUIRE(!map.contains(std::string_view{"four"}));
+
+    const std::string key = "three";
+    REQUIRE(*map.find(key) == 3);
+    REQUIRE(*map.find("one") == 1);
+
+    REQUIRE(constant_initialized.insert(1, 1));
+    REQUIRE(constant_initialized.erase(1));
+}
+
+TEST_CASE("ln::StaticHashMap matches std::unordered_map under churn", "[ln::StaticHashMap]") {
+    static constexpr int key_range = 400;
+    ln::StaticHashMap<std::uint32_t, int, 256> map{};
+    std::unordered_map<std::uint32_t, int> model;
+    std::mt19937 random{7};
+    std::uniform_int_distribution<std::uint32_t> key{0, key_range - 1};
+
+    for (int i = 0; i < 50'000; ++i) {
+        const std::uint32_t k = key(random);
+        if (random() % 2) {
+            const bool inserted = map.insert_or_assign(k, i);
+            REQUIRE(inserted == (model.contains(k) || model.size() < map.capacity()));
+            if (inserted) {
+                model[k] = i;
+            }
+        }
+        else {
+            REQUIRE(map.erase(k) == (model.erase(k) == 1));
+        }
+        REQUIRE(map.size() == model.size());
+    }
+    for (std::uint32_t k = 0; k < key_range; ++k) {
+        const int *value = map.find(k);
+        const auto expected = model.find(k);
+        REQUIRE((value != nullptr) == (expected != model.end()));
+        if (value) {
+            REQUIRE(*value == expected->second);
+        }
+    }
+}
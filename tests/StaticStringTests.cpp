@@ -0,0 +1,83 @@
+#include "ln/StaticString.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+using namespace std::string_view_literals;
+
+TEST_CASE("ln::StaticString append", "[ln::StaticString]") {
+    ln::StaticString<8> s{};
+    REQUIRE(s.empty());
+    REQUIRE(s.capacity() == 8);
+    REQUIRE(std::strlen(s.c_str()) == 0);
+
+    REQUIRE(s.append("abc"));
+    REQUIRE(s.append('-', 2));
+    REQUIRE(s == "abc--");
+    REQUIRE_FALSE(s.append("defgh"));
+    REQUIRE(s.full());
+    REQUIRE(s.view() == "abc--def");
+    REQUIRE(std::strlen(s.c_str()) == 8);
+
+    s.truncate(3);
+    REQUIRE(std::string_view{s} == "abc");
+    s.clear();
+    REQUIRE(s.c_str() == ""sv);
+}
+
+TEST_CASE("ln::StaticString formatted append", "[ln::StaticString]") {
+    ln::StaticString<16> s{"x="};
+    REQUIRE(s.appendf("%d, y=%s", 42, "ok"));
+    REQUIRE(s == "x=42, y=ok");
+
+    REQUIRE_FALSE(s.appendf("%08X", 0xDEADBEEFU));
+    REQUIRE(s == "x=42, y=okDEADBE");
+    REQUIRE(s.c_str()[16] == '\0');
+    REQUIRE_FALSE(s.appendf("%d", 1));
+    REQUIRE(s.size() == 16);
+}
+
+TEST_CASE("ln::StaticString insert and erase", "[ln::StaticString]") {
+    ln::StaticString<4> s{"ac"};
+    REQUIRE(s.insert(1, 'b'));
+    REQUIRE(s.insert(3, 'd'));
+    REQUIRE(s == "abcd");
+    REQUIRE_FALSE(s.insert(0, 'z'));
+
+    s.erase(0);
+    REQUIRE(s == "bcd");
+    s.erase(1, 10);
+    REQUIRE(s == "b");
+    s.erase(5);
+    REQUIRE(s == "b");
+    REQUIRE_FALSE(s.insert(3, 'x'));
+}
+
+TEST_CASE("ln::StaticString copies and external storage", "[ln::StaticString]") {
+    ln::StaticString<8> a{"too long to fit"};
+    REQUIRE(a == "too long");
+    ln::StaticString<8> b{a};
+    b = "copy";
+    a = b;
+    REQUIRE(a == "copy");
+    REQUIRE(a.data() != b.data());
+
+    std::array<char, 4> storage{'?', '?', '?', '?'};
+    ln::StringBuffer buffer{storage};
+    REQUIRE(storage[0] == '\0');
+    REQUIRE(buffer.capacity() == 3);
+    REQUIRE_FALSE(buffer.appendf("%s", "abcd"));
+    REQUIRE(std::string_view{storage.data()} == "abc");
+
+    ln::StringBuffer empty{std::span<char>{}};
+    REQUIRE(empty.capacity() == 0);
+    REQUIRE_FALSE(empty.append("a"));
+    REQUIRE_FALSE(empty.appendf("a"));
+    REQUIRE(empty.c_str() == ""sv);
+}
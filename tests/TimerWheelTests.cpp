@@ -0,0 +1,259 @@
+#include "ln/TimerWheel.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+namespace {
+
+// the test is both the tick source and the service
+class ManualWheel : public ln::TimerWheel {
+public:
+    int notify_count = 0;
+
+    // tick count times, servicing after each tick
+    void step(std::uint32_t count) {
+        for (std::uint32_t i = 0; i < count; ++i) {
+            this->tick();
+            (void)this->run_pending();
+        }
+    }
+
+    // tick count times, then service once, like a service that fell behind
+    void skip(std::uint32_t count) {
+        for (std::uint32_t i = 0; i < count; ++i) {
+            this->tick();
+        }
+        (void)this->run_pending();
+    }
+
+    // tick count times, servicing only when notified, like ln::drivers::TimerTask
+    void serve(std::uint32_t count) {
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const int notified = this->notify_count;
+            this->tick();
+            if (this->notify_count != notified) {
+                (void)this->run_pending();
+            }
+        }
+    }
+
+protected:
+    void ll_notify() override { ++this->notify_count; }
+};
+
+} // namespace
+
+TEST_CASE("ln::TimerWheel fires one-shot timers on their tick", "[ln::TimerWheel]") {
+    // delays around every level boundary, and past the span of the wheel
+    const std::uint32_t delay = GENERATE(1u, 2u, 63u, 64u, 65u, 127u, 128u, 4095u, 4096u, 4097u, 262'143u, 262'144u,
+                                         300'000u, ln::TimerWheel::max_span, ln::TimerWheel::max_span + 1,
+                                         ln::TimerWheel::max_span + 70'000);
+    const std::uint32_t offset = GENERATE(0u, 63u, 4000u);
+    ManualWheel wheel{};
+    wheel.skip(offset);
+
+    std::uint32_t fired_at = 0;
+    int fired = 0;
+    ln::Timer timer{[&] {
+        fired_at = wheel.get_now();
+        ++fired;
+    }};
+    wheel.start(timer, delay);
+    REQUIRE(timer.is_active());
+    REQUIRE(wheel.get_stats().active == 1);
+
+    wheel.skip(delay - 1);
+    REQUIRE(fired == 0);
+    wheel.step(1);
+    REQUIRE(fired == 1);
+    REQUIRE(fired_at == offset + delay);
+    REQUIRE_FALSE(timer.is_active());
+    REQUIRE(wheel.get_stats().active == 0);
+    REQUIRE(timer.get_stats().last_lateness == 0);
+}
+
+TEST_CASE("ln::TimerWheel cancels and re-arms timers", "[ln::TimerWheel]") {
+    ManualWheel wheel{};
+    int fired = 0;
+    ln::Timer a{[&] { ++fired; }};
+    ln::Timer b{[&] { ++fired; }};
+    ln::Timer c{[&] { ++fired; }};
+
+    REQUIRE_FALSE(wheel.cancel(a));
+    // same slot, so cancelling unlinks from the head, middle and tail
+    wheel.start(a, 10);
+    wheel.start(b, 10);
+    wheel.start(c, 10);
+    REQUIRE(wheel.cancel(b));
+    REQUIRE_FALSE(b.is_active());
+    REQUIRE(wheel.get_stats().active == 2);
+    REQUIRE(wheel.cancel(c));
+    REQUIRE(wheel.cancel(a));
+    wheel.step(20);
+    REQUIRE(fired == 0);
+
+    // starting an active timer moves it
+    wheel.start(a, 5);
+    wheel.start(a, 500);
+    wheel.step(499);
+    REQUIRE(fired == 0);
+    wheel.step(1);
+    REQUIRE(fired == 1);
+    REQUIRE(wheel.get_stats().active == 0);
+}
+
+TEST_CASE("ln::TimerWheel runs periodic timers without drift", "[ln::TimerWheel]") {
+    ManualWheel wheel{};
+    std::vector<std::uint32_t> fired_at;
+    ln::Timer timer{[&] { fired_at.push_back(wheel.get_now()); }};
+    wheel.start(timer, 100, 70);
+    wheel.step(100 + 70 * 9);
+    REQUIRE(fired_at.size() == 10);
+    for (size_t i = 0; i < fired_at.size(); ++i) {
+        REQUIRE(fired_at[i] == 100 + 70 * i);
+    }
+    REQUIRE(timer.is_active());
+    REQUIRE(timer.get_period() == 70);
+    REQUIRE(wheel.cancel(timer));
+}
+
+TEST_CASE("ln::TimerWheel counts lateness and overruns of a slow service", "[ln::TimerWheel]") {
+    ManualWheel wheel{};
+    int fired = 0;
+    ln::Timer timer{[&] { ++fired; }};
+    wheel.start(timer, 10, 10);
+
+    // the service falls 35 ticks behind: due at 10, runs at 45
+    for (int i = 0; i < 45; ++i) {
+        wheel.tick();
+    }
+    // notified from the due tick on
+    REQUIRE(wheel.notify_count == 36);
+    REQUIRE(wheel.get_stats().pending_ticks == 45);
+    REQUIRE(wheel.run_pending() == 1);
+    REQUIRE(wheel.get_stats().pending_ticks == 0);
+
+    auto stats = timer.get_stats();
+    REQUIRE(fired == 1);
+    REQUIRE(stats.last_lateness == 35);
+    REQUIRE(stats.max_lateness == 35);
+    // expiries at 20, 30 and 40 are skipped, the next one is at 50
+    REQUIRE(stats.overruns == 3);
+    wheel.step(4);
+    REQUIRE(fired == 1);
+    wheel.step(1);
+    REQUIRE(fired == 2);
+    REQUIRE(timer.get_stats().last_lateness == 0);
+
+    const auto wheel_stats = wheel.get_stats();
+    REQUIRE(wheel_stats.fired == 2);
+    REQUIRE(wheel_stats.overruns == 3);
+    REQUIRE(wheel_stats.max_lateness == 35);
+    REQUIRE(wheel.cancel(timer));
+}
+
+TEST_CASE("ln::TimerWheel callbacks may cancel and restart their timer", "[ln::TimerWheel]") {
+    ManualWheel wheel{};
+    int fired = 0;
+    ln::Timer periodic{};
+    periodic.set_callback([&] {
+        if (++fired == 3) {
+            (void)wheel.cancel(periodic);
+        }
+    });
+    wheel.start(periodic, 1, 1);
+    wheel.step(10);
+    REQUIRE(fired == 3);
+    REQUIRE_FALSE(periodic.is_active());
+
+    int restarted = 0;
+    ln::Timer one_shot{};
+    one_shot.set_callback([&] {
+        if (++restarted < 4) {
+            wheel.start(one_shot, 100);
+        }
+    });
+    wheel.start(one_shot, 100);
+    wheel.step(1000);
+    REQUIRE(restarted == 4);
+    REQUIRE(wheel.get_now() == 1010);
+}
+
+TEST_CASE("ln::TimerWheel wakes the service only when work is due", "[ln::TimerWheel]") {
+    ManualWheel wheel{};
+    wheel.serve(1000);
+    REQUIRE(wheel.notify_count == 0);
+    REQUIRE(wheel.get_stats().pending_ticks == 1000);
+    (void)wheel.run_pending();
+    REQUIRE(wheel.get_now() == 1000);
+
+    std::vector<std::uint32_t> fired_at;
+    ln::Timer one_shot{[&] { fired_at.push_back(wheel.get_now()); }};
+    wheel.start(one_shot, 500);
+    wheel.serve(499);
+    REQUIRE(wheel.notify_count == 0);
+    wheel.serve(1);
+    REQUIRE(wheel.notify_count == 1);
+    REQUIRE(fired_at == std::vector<std::uint32_t>{1500});
+
+    // further out than level 0: woken to cascade every 64 ticks, then on expiry
+    ln::Timer periodic{[&] { fired_at.push_back(wheel.get_now()); }};
+    wheel.start(periodic, 1000, 1000);
+    wheel.serve(3000);
+    REQUIRE(fired_at == std::vector<std::uint32_t>{1500, 2500, 3500, 4500});
+    REQUIRE(wheel.notify_count <= 1 + 3000 / 64 + 3);
+    REQUIRE(wheel.cancel(periodic));
+    wheel.serve(1000);
+    REQUIRE(fired_at.size() == 4);
+}
+
+TEST_CASE("ln::TimerWheel matches a brute force model", "[ln::TimerWheel]") {
+    static constexpr size_t timer_count = 2000;
+    std::mt19937 random{42};
+    std::uniform_int_distribution<std::uint32_t> delay{0, 20'000};
+    ManualWheel wheel{};
+    // serviced after every tick, or only when notified
+    const bool lazy = GENERATE(false, true);
+    const auto run = [&](std::uint32_t count) { lazy ? wheel.serve(count) : wheel.step(count); };
+    wheel.skip(100);
+
+    std::vector<std::uint32_t> due(timer_count, 0);
+    std::vector<std::uint32_t> fired_at(timer_count, 0);
+    std::vector<std::unique_ptr<ln::Timer>> timers;
+    for (size_t i = 0; i < timer_count; ++i) {
+        timers.push_back(std::make_unique<ln::Timer>([&, i] { fired_at[i] = wheel.get_now(); }));
+    }
+    for (size_t i = 0; i < timer_count; ++i) {
+        const std::uint32_t d = delay(random) + 1;
+        wheel.start(*timers[i], d);
+        due[i] = wheel.get_now() + d;
+    }
+    // cancel every third timer, and re-arm every fifth half way through
+    for (size_t i = 0; i < timer_count; i += 3) {
+        REQUIRE(wheel.cancel(*timers[i]));
+        due[i] = 0;
+    }
+    run(5000);
+    (void)wheel.run_pending();
+    for (size_t i = 0; i < timer_count; i += 5) {
+        if (!timers[i]->is_active()) {
+            continue;
+        }
+        const std::uint32_t d = delay(random) + 1;
+        wheel.start(*timers[i], d);
+        due[i] = wheel.get_now() + d;
+    }
+    run(30'000);
+
+    REQUIRE(wheel.get_stats().active == 0);
+    for (size_t i = 0; i < timer_count; ++i) {
+        REQUIRE(fired_at[i] == due[i]);
+    }
+}
@@ -0,0 +1,286 @@
+#include "ln/Tlsf.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+namespace {
+
+constexpr std::size_t heap_size = 32 * 1024;
+constexpr std::size_t slot_count = 256;
+constexpr std::size_t operation_count = 100'000;
+
+/**
+ * @brief Host model of FreeRTOS heap_4.c: an address-ordered free list with
+ * first-fit allocation and coalescing on free.
+ *
+ * It mirrors the kernel source closely enough to reproduce its block layout,
+ * splitting threshold and list walk, and counts the free blocks visited per
+ * allocation, the cost TLSF bounds.
+ */
+class Heap4 {
+public:
+    explicit Heap4(std::span<std::byte> storage) {
+        auto address = reinterpret_cast<std::uintptr_t>(storage.data());
+        const std::uintptr_t aligned = (address + alignment - 1) & ~(alignment - 1);
+        const std::size_t total = (storage.size() - (aligned - address)) & ~(alignment - 1);
+        this->start.next = reinterpret_cast<Link *>(aligned);
+        this->start.size = 0;
+        this->end = reinterpret_cast<Link *>(aligned + total - header_size);
+        this->end->next = nullptr;
+        this->end->size = 0;
+        Link *first = this->start.next;
+        first->size = reinterpret_cast<std::uintptr_t>(this->end) - aligned;
+        first->next = this->end;
+        this->free_bytes = first->size;
+    }
+
+    void *allocate(std::size_t size) {
+        if (size == 0 || size > allocated_bit - header_size - alignment) {
+            return nullptr;
+        }
+        size = (size + header_size + alignment - 1) & ~(alignment - 1);
+        if (size > this->free_bytes) {
+            return nullptr;
+        }
+        Link *prev = &this->start;
+        Link *block = this->start.next;
+        std::size_t visited = 1;
+        while (block->size < size && block->next) {
+            prev = block;
+            block = block->next;
+            ++visited;
+        }
+        this->allocate_walk.record(visited);
+        if (block == this->end) {
+            return nullptr;
+        }
+        prev->next = block->next;
+        if (block->size - size > min_block_size) {
+            auto *remaining = reinterpret_cast<Link *>(reinterpret_cast<std::byte *>(block) + size);
+            remaining->size = block->size - size;
+            block->size = size;
+            this->insert(remaining);
+        }
+        this->free_bytes -= block->size;
+        block->size |= allocated_bit;
+        block->next = nullptr;
+        return reinterpret_cast<std::byte *>(block) + header_size;
+    }
+
+    void deallocate(void *pointer) {
+        if (!pointer) {
+            return;
+        }
+        auto *block = reinterpret_cast<Link *>(static_cast<std::byte *>(pointer) - header_size);
+        block->size &= ~allocated_bit;
+        this->free_bytes += block->size;
+        this->insert(block);
+    }
+
+    [[nodiscard]] std::size_t get_free_size() const { return this->free_bytes; }
+
+    [[nodiscard]] std::size_t get_largest_free_block() const {
+        std::size_t largest = 0;
+        for (const Link *block = this->start.next; block != this->end; block = block->next) {
+            largest = std::max(largest, block->size - header_size);
+        }
+        return largest;
+    }
+
+    struct Walk {
+        std::size_t max = 0;
+        std::size_t total = 0;
+        std::size_t count = 0;
+
+        void record(std::size_t visited) {
+            this->max = std::max(this->max, visited);
+            this->total += visited;
+            ++this->count;
+        }
+    };
+
+    Walk allocate_walk{}; ///< free blocks visited to find a fit
+    Walk insert_walk{};   ///< free blocks visited to insert a block in address order
+
+private:
+    struct Link {
+        Link *next;
+        std::size_t size;
+    };
+
+    static constexpr std::size_t alignment = 8;
+    static constexpr std::size_t header_size = (sizeof(Link) + alignment - 1) & ~(alignment - 1);
+    static constexpr std::size_t min_block_size = header_size * 2;
+    static constexpr std::size_t allocated_bit = std::size_t{1} << (sizeof(std::size_t) * 8 - 1);
+
+    void insert(Link *block) {
+        Link *it = &this->start;
+        std::size_t visited = 1;
+        while (it->next < block) {
+            it = it->next;
+            ++visited;
+        }
+        this->insert_walk.record(visited);
+        if (reinterpret_cast<std::byte *>(it) + it->size == reinterpret_cast<std::byte *>(block)) {
+            it->size += block->size;
+            block = it;
+        }
+        if (reinterpret_cast<std::byte *>(block) + block->size == reinterpret_cast<std::byte *>(it->next) &&
+            it->next != this->end) {
+            block->size += it->next->size;
+            block->next = it->next->next;
+        }
+        else {
+            block->next = it->next;
+        }
+        if (it != block) {
+            it->next = block;
+        }
+    }
+
+    Link start{};
+    Link *end = nullptr;
+    std::size_t free_bytes = 0;
+};
+
+/**
+ * @brief Randomized workload: slots are picked at random and freed if taken,
+ * otherwise filled with a mostly small, occasionally large allocation, which
+ * keeps the heap near its limit and fragments it.
+ */
+struct Workload {
+    struct Operation {
+        std::uint16_t slot;
+        std::uint16_t size;
+    };
+
+    Workload() {
+        std::mt19937 rng{42};
+        std::uniform_int_distribution<std::uint16_t> slot_dist{0, slot_count - 1};
+        std::uniform_int_distribution<std::uint16_t> small_dist{8, 128};
+        std::uniform_int_distribution<std::uint16_t> large_dist{256, 2048};
+        operations.reserve(operation_count);
+        for (std::size_t i = 0; i < operation_count; ++i) {
+            operations.push_back({slot_dist(rng), rng() % 8 == 0 ? large_dist(rng) : small_dist(rng)});
+        }
+    }
+
+    std::vector<Operation> operations;
+};
+
+const Workload workload{};
+
+struct Report {
+    std::size_t failed = 0;
+    std::vector<std::chrono::nanoseconds> allocate_latency;
+    std::vector<std::chrono::nanoseconds> deallocate_latency;
+    std::size_t free = 0;
+    std::size_t largest_free_block = 0;
+};
+
+/**
+ * @brief Returns the given percentile of latencies. The maximum is left out
+ * on purpose, on a host it measures preemption rather than the allocator.
+ */
+std::chrono::nanoseconds percentile(std::vector<std::chrono::nanoseconds> latencies, double fraction) {
+    if (latencies.empty()) {
+        return {};
+    }
+    const auto nth =
+        latencies.begin() + static_cast<std::ptrdiff_t>(fraction * static_cast<double>(latencies.size() - 1));
+    std::nth_element(latencies.begin(), nth, latencies.end());
+    return *nth;
+}
+
+template <typename Heap> Report run(Heap &heap, bool timed) {
+    using Clock = std::chrono::steady_clock;
+    std::array<void *, slot_count> slots{};
+    Report report{};
+    for (const auto &operation : workload.operations) {
+        void *&slot = slots[operation.slot];
+        const auto begin = timed ? Clock::now() : Clock::time_point{};
+        if (slot) {
+            heap.deallocate(slot);
+            slot = nullptr;
+            if (timed) {
+                report.deallocate_latency.push_back(Clock::now() - begin);
+            }
+        }
+        else {
+            slot = heap.allocate(operation.size);
+            report.failed += slot == nullptr;
+            if (timed) {
+                report.allocate_latency.push_back(Clock::now() - begin);
+            }
+        }
+    }
+    report.free = heap.get_free_size();
+    if constexpr (requires { heap.get_stats(); }) {
+        report.largest_free_block = heap.get_stats().largest_free_block;
+    }
+    else {
+        report.largest_free_block = heap.get_largest_free_block();
+    }
+    for (void *slot : slots) {
+        heap.deallocate(slot);
+    }
+    return report;
+}
+
+void print(const char *name, const Report &report) {
+    const double fragmentation =
+        report.free ? 1.0 - static_cast<double>(report.largest_free_block) / static_cast<double>(report.free) : 0.0;
+    WARN(name << ": failed allocations " << report.failed << "/" << operation_count << ", free " << report.free
+              << " B, largest free block " << report.largest_free_block << " B, fragmentation "
+              << fragmentation * 100.0 << " %, allocate p50/p99.9 "
+              << percentile(report.allocate_latency, 0.5).count() << "/"
+              << percentile(report.allocate_latency, 0.999).count() << " ns, deallocate p50/p99.9 "
+              << percentile(report.deallocate_latency, 0.5).count() << "/"
+              << percentile(report.deallocate_latency, 0.999).count() << " ns");
+}
+
+} // namespace
+
+TEST_CASE("ln::Tlsf vs heap_4 fragmentation and latency", "[benchmark][ln::Tlsf]") {
+    {
+        static ln::StaticTlsf<heap_size> tlsf{};
+        print("ln::Tlsf", run(tlsf, true));
+        // TLSF visits no list: a fit is found with two bit scans, frees merge with physical neighbours only
+    }
+    {
+        alignas(8) static std::array<std::byte, heap_size> storage{};
+        Heap4 heap{storage};
+        const auto report = run(heap, true);
+        print("heap_4", report);
+        const auto mean = [](const Heap4::Walk &walk) {
+            return static_cast<double>(walk.total) / static_cast<double>(walk.count);
+        };
+        WARN("heap_4: free blocks visited per allocation worst "
+             << heap.allocate_walk.max << ", mean " << mean(heap.allocate_walk) << "; per insertion worst "
+             << heap.insert_walk.max << ", mean " << mean(heap.insert_walk));
+    }
+}
+
+TEST_CASE("ln::Tlsf vs heap_4 randomized workload", "[benchmark][ln::Tlsf]") {
+    BENCHMARK("ln::Tlsf") {
+        static ln::StaticTlsf<heap_size> tlsf{};
+        return run(tlsf, false).failed;
+    };
+
+    BENCHMARK("heap_4") {
+        alignas(8) static std::array<std::byte, heap_size> storage{};
+        Heap4 heap{storage};
+        return run(heap, false).failed;
+    };
+}
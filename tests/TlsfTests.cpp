@@ -0,0 +1,188 @@
+#include "ln/Tlsf.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+extern "C" void ln_panic(const char * /*file*/, int /*line*/) { std::abort(); }
+
+namespace {
+
+bool is_aligned(const void *pointer, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+
+} // namespace
+
+TEST_CASE("ln::Tlsf allocate and deallocate", "[ln::Tlsf]") {
+    ln::StaticTlsf<4096> tlsf{};
+    REQUIRE(tlsf.check());
+    REQUIRE(tlsf.capacity() > 4000);
+    REQUIRE(tlsf.get_free_size() == tlsf.capacity());
+
+    void *a = tlsf.allocate(1);
+    void *b = tlsf.allocate(100);
+    void *c = tlsf.allocate(1000);
+    REQUIRE(a);
+    REQUIRE(b);
+    REQUIRE(c);
+    REQUIRE(is_aligned(a, ln::Tlsf::alignment));
+    REQUIRE(is_aligned(b, ln::Tlsf::alignment));
+    REQUIRE(is_aligned(c, ln::Tlsf::alignment));
+    REQUIRE(ln::Tlsf::get_usable_size(b) >= 100);
+    std::memset(c, 0xAB, 1000);
+    REQUIRE(tlsf.check());
+
+    tlsf.deallocate(b);
+    REQUIRE(tlsf.check());
+    tlsf.deallocate(a);
+    tlsf.deallocate(c);
+    tlsf.deallocate(nullptr);
+    REQUIRE(tlsf.check());
+    REQUIRE(tlsf.get_free_size() == tlsf.capacity());
+
+    const auto stats = tlsf.get_stats();
+    REQUIRE(stats.free_block_count == 1);
+    REQUIRE(stats.allocation_count == 3);
+    REQUIRE(stats.free_count == 3);
+    REQUIRE(stats.min_ever_free < tlsf.capacity());
+}
+
+TEST_CASE("ln::Tlsf rejects zero, oversized and exhausting requests", "[ln::Tlsf]") {
+    ln::StaticTlsf<1024> tlsf{};
+    REQUIRE(tlsf.allocate(0) == nullptr);
+    REQUIRE(tlsf.allocate(2048) == nullptr);
+    REQUIRE(tlsf.allocate(std::numeric_limits<std::size_t>::max()) == nullptr);
+
+    std::vector<void *> blocks;
+    while (void *block = tlsf.allocate(64)) {
+        blocks.push_back(block);
+    }
+    REQUIRE(blocks.size() >= 10);
+    REQUIRE(tlsf.get_stats().largest_free_block < 64);
+    REQUIRE(tlsf.check());
+    for (void *block : blocks) {
+        tlsf.deallocate(block);
+    }
+    REQUIRE(tlsf.get_stats().free_block_count == 1);
+}
+
+TEST_CASE("ln::Tlsf coalesces neighbours", "[ln::Tlsf]") {
+    ln::StaticTlsf<2048> tlsf{};
+    const std::size_t largest = tlsf.get_stats().largest_free_block;
+
+    std::array<void *, 5> blocks{};
+    for (auto &block : blocks) {
+        block = tlsf.allocate(200);
+        REQUIRE(block);
+    }
+    // free out of order: left neighbour, right neighbour, then both at once
+    tlsf.deallocate(blocks[1]);
+    tlsf.deallocate(blocks[3]);
+    REQUIRE(tlsf.get_stats().free_block_count == 3);
+    tlsf.deallocate(blocks[2]);
+    REQUIRE(tlsf.get_stats().free_block_count == 2);
+    REQUIRE(tlsf.check());
+
+    // the merged hole fits what the three separate blocks held
+    void *merged = tlsf.allocate(600);
+    REQUIRE(merged == blocks[1]);
+    tlsf.deallocate(merged);
+    tlsf.deallocate(blocks[0]);
+    tlsf.deallocate(blocks[4]);
+    REQUIRE(tlsf.get_stats().free_block_count == 1);
+    REQUIRE(tlsf.get_stats().largest_free_block == largest);
+    REQUIRE(tlsf.check());
+}
+
+TEST_CASE("ln::Tlsf over-aligned allocation", "[ln::Tlsf]") {
+    ln::StaticTlsf<8192> tlsf{};
+    for (std::size_t alignment : {16, 32, 64, 256, 1024}) {
+        void *padding = tlsf.allocate(24);
+        void *block = tlsf.allocate(100, alignment);
+        REQUIRE(block);
+        REQUIRE(is_aligned(block, alignment));
+        REQUIRE(ln::Tlsf::get_usable_size(block) >= 100);
+        REQUIRE(tlsf.check());
+        tlsf.deallocate(padding);
+        tlsf.deallocate(block);
+    }
+    REQUIRE(tlsf.allocate(8, 24) == nullptr);
+    REQUIRE(tlsf.check());
+    REQUIRE(tlsf.get_free_size() == tlsf.capacity());
+}
+
+TEST_CASE("ln::Tlsf randomized workload keeps the heap consistent", "[ln::Tlsf]") {
+    ln::StaticTlsf<32 * 1024> tlsf{};
+    std::mt19937 rng{1234};
+    std::uniform_int_distribution<std::size_t> size_dist{1, 700};
+    std::uniform_int_distribution<int> alignment_log2_dist{0, 7};
+
+    struct Allocation {
+        std::size_t size;
+        std::uint8_t fill;
+    };
+    std::map<std::uint8_t *, Allocation> live;
+    std::size_t failures = 0;
+
+    for (int step = 0; step < 20'000; ++step) {
+        if (live.empty() || rng() % 5 < 3) {
+            const std::size_t size = size_dist(rng);
+            const std::size_t alignment = std::size_t{1} << alignment_log2_dist(rng);
+            auto *block = static_cast<std::uint8_t *>(tlsf.allocate(size, alignment));
+            if (!block) {
+                ++failures;
+                continue;
+            }
+            REQUIRE(is_aligned(block, alignment));
+            const auto fill = static_cast<std::uint8_t>(step);
+            std::memset(block, fill, size);
+            live.emplace(block, Allocation{size, fill});
+        }
+        else {
+            auto it = std::next(live.begin(), static_cast<std::ptrdiff_t>(rng() % live.size()));
+            const auto [block, allocation] = *it;
+            REQUIRE(std::all_of(block, block + allocation.size, [&](std::uint8_t b) { return b == allocation.fill; }));
+            tlsf.deallocate(block);
+            live.erase(it);
+        }
+        if (step % 256 == 0) {
+            REQUIRE(tlsf.check());
+        }
+    }
+    REQUIRE(failures > 0);
+    for (const auto &[block, allocation] : live) {
+        tlsf.deallocate(block);
+    }
+    REQUIRE(tlsf.check());
+    REQUIRE(tlsf.get_free_size() == tlsf.capacity());
+    REQUIRE(tlsf.get_stats().free_block_count == 1);
+}
+
+TEST_CASE("ln::TlsfResource backs pmr containers", "[ln::Tlsf]") {
+    ln::StaticTlsf<8192> tlsf{};
+    ln::TlsfResource resource{tlsf};
+    {
+        std::pmr::vector<std::pmr::string> strings{&resource};
+        for (int i = 0; i < 50; ++i) {
+            strings.emplace_back(std::string(40, static_cast<char>('a' + i % 26)));
+        }
+        REQUIRE(std::string_view{strings[27]} == std::string(40, 'b'));
+        REQUIRE(tlsf.get_free_size() < tlsf.capacity());
+        REQUIRE(tlsf.check());
+    }
+    REQUIRE(tlsf.get_free_size() == tlsf.capacity());
+    REQUIRE(resource.is_equal(resource));
+
+    ln::TlsfResource other{tlsf};
+    REQUIRE_FALSE(resource.is_equal(other));
+}
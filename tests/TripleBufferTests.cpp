@@ -0,0 +1,92 @@
+#include "ln/TripleBuffer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace {
+
+struct Frame {
+    std::uint32_t sequence;
+    std::array<std::uint32_t, 32> samples;
+};
+
+} // namespace
+
+TEST_CASE("ln::TripleBuffer hands the reader the latest published value", "[ln::TripleBuffer]") {
+    ln::TripleBuffer<int> buffer{-1};
+    REQUIRE_FALSE(buffer.has_update());
+    REQUIRE_FALSE(buffer.update());
+    REQUIRE(buffer.read() == -1);
+
+    buffer.write(1);
+    REQUIRE(buffer.has_update());
+    REQUIRE(buffer.read() == 1);
+    REQUIRE_FALSE(buffer.has_update());
+
+    // values the reader did not pick up in time are skipped
+    buffer.write(2);
+    buffer.write(3);
+    buffer.write(4);
+    REQUIRE(buffer.update());
+    REQUIRE(buffer.read_buffer() == 4);
+    REQUIRE_FALSE(buffer.update());
+    REQUIRE(buffer.read_buffer() == 4);
+}
+
+TEST_CASE("ln::TripleBuffer keeps the read buffer stable until update", "[ln::TripleBuffer]") {
+    ln::TripleBuffer<std::string> buffer{};
+    buffer.write_buffer() = "first";
+    buffer.publish();
+    const std::string &held = buffer.read();
+    REQUIRE(held == "first");
+
+    // the writer cycles through the other two buffers only
+    for (int i = 0; i < 5; ++i) {
+        buffer.write_buffer() = "overwrite";
+        buffer.publish();
+        REQUIRE(held == "first");
+        REQUIRE(&buffer.write_buffer() != &held);
+    }
+    REQUIRE(buffer.read() == "overwrite");
+}
+
+TEST_CASE("ln::TripleBuffer never tears a value across threads", "[ln::TripleBuffer][threads]") {
+    static constexpr std::uint32_t frame_count = 500'000;
+    ln::TripleBuffer<Frame> buffer{};
+    std::atomic<bool> done{false};
+
+    std::thread writer([&] {
+        for (std::uint32_t i = 1; i <= frame_count; ++i) {
+            Frame &frame = buffer.write_buffer();
+            frame.sequence = i;
+            frame.samples.fill(i);
+            buffer.publish();
+        }
+        done = true;
+    });
+
+    std::uint32_t last = 0;
+    std::uint32_t torn = 0;
+    std::uint32_t backwards = 0;
+    while (!done || buffer.has_update()) {
+        if (!buffer.update()) {
+            continue;
+        }
+        const Frame &frame = buffer.read_buffer();
+        for (const std::uint32_t sample : frame.samples) {
+            torn += sample != frame.sequence;
+        }
+        backwards += frame.sequence <= last;
+        last = frame.sequence;
+    }
+    writer.join();
+
+    REQUIRE(torn == 0);
+    REQUIRE(backwards == 0);
+    REQUIRE(last == frame_count);
+}